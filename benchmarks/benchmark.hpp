@@ -0,0 +1,96 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <string_view>
+
+#if defined(__linux__)
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+// Count retired user space instructions (Linux only)
+struct InstructionCounter {
+  InstructionCounter() {
+#if defined(__linux__)
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    _fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+
+  ~InstructionCounter() {
+#if defined(__linux__)
+    if (_fd >= 0) close(_fd);
+#endif
+  }
+
+  void start() {
+#if defined(__linux__)
+    if (_fd < 0) return;
+    ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+  }
+
+  std::optional<uint64_t> stop() {
+#if defined(__linux__)
+    if (_fd < 0) return std::nullopt;
+    ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t count{};
+    if (read(_fd, &count, sizeof(count)) != sizeof(count)) return std::nullopt;
+    return count;
+#else
+    return std::nullopt;
+#endif
+  }
+
+private:
+  [[maybe_unused]] int _fd{-1};
+};
+
+// Result of a single benchmark
+struct Result {
+  double ns{};                          ///< Nanoseconds per operation
+  std::optional<double> instructions{}; ///< Instructions per operation
+};
+
+// Call f once and divide time and instructions by number of operations n
+template<typename F>
+Result measure(size_t n, F&& f) {
+  InstructionCounter counter;
+  auto const start{std::chrono::steady_clock::now()};
+  counter.start();
+  f();
+  auto const instructions{counter.stop()};
+  auto const stop{std::chrono::steady_clock::now()};
+  Result retval{
+    .ns = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+              .count()) /
+          static_cast<double>(n)};
+  if (instructions)
+    retval.instructions =
+      static_cast<double>(*instructions) / static_cast<double>(n);
+  return retval;
+}
+
+// Print result as single row
+inline void print(std::string_view name, size_t n, Result const& result) {
+  std::printf("%-24.*s %10zu %10.2f ",
+              static_cast<int>(size(name)),
+              data(name),
+              n,
+              result.ns);
+  if (result.instructions) std::printf("%12.2f\n", *result.instructions);
+  else std::printf("%12s\n", "n/a");
+}
@@ -0,0 +1,206 @@
+// Benchmark packets lost while CVs get written to (simulated) flash
+//
+// Usage: DCCBenchmarkCvJournal
+//
+// A command station sends numbered function packets and every so often a
+// POM write. While a CV write blocks execute, received packets pile up in
+// the deque until it overflows. Writing through to flash is compared against
+// the write-behind CV journal which only flushes once per second.
+
+#include <dcc/dcc.hpp>
+#include <dcc/rx/cv_journal.hpp>
+#include <dcc/rx/sim_flash.hpp>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+// Number of function packets
+constexpr size_t packets{100'000uz};
+
+// Every n-th packet is followed by two identical POM write packets
+constexpr size_t pom_interval{500uz};
+
+// Two 128 KiB sectors with typical latencies of a STM32F4
+using Flash = dcc::rx::SimFlash<128uz * 1024uz, 2uz>;
+constexpr Flash::Latencies latencies{.erase = 1s, .program = 10us};
+
+// Number of CVs
+constexpr size_t cvs{1024uz};
+
+// Erase and program the whole image on every write
+struct WriteThrough {
+  WriteThrough(Flash& flash) : _flash{flash} {}
+
+  void load(std::span<uint8_t const, cvs> defaults) {
+    std::ranges::copy(defaults, begin(_cvs));
+  }
+
+  uint8_t readCv(uint32_t cv_addr) const {
+    return cv_addr < size(_cvs) ? _cvs[cv_addr] : 0u;
+  }
+
+  uint8_t writeCv(uint32_t cv_addr, uint8_t byte) {
+    if (cv_addr >= size(_cvs) || _cvs[cv_addr] == byte) return byte;
+    _cvs[cv_addr] = byte;
+    _flash.erase(0uz);
+    _flash.program(0uz, _cvs);
+    return byte;
+  }
+
+  void idle(std::chrono::microseconds) {}
+
+private:
+  Flash& _flash;
+  std::array<uint8_t, cvs> _cvs{};
+};
+
+// Flush journal once per second
+struct Journal : dcc::rx::CvJournal<Flash, cvs> {
+  using dcc::rx::CvJournal<Flash, cvs>::CvJournal;
+
+  void idle(std::chrono::microseconds now) {
+    if (now - _last < 1s) return;
+    _last = now;
+    flush();
+  }
+
+private:
+  std::chrono::microseconds _last{};
+};
+
+// Decoder which counts received function packets
+template<typename Store>
+struct Decoder : dcc::rx::CrtpBase<Decoder<Store>> {
+  friend dcc::rx::CrtpBase<Decoder<Store>>;
+
+  Decoder(Flash& flash) : _store{flash} {
+    std::array<uint8_t, cvs> defaults{};
+    defaults[29uz - 1uz] = 0b1010u;            // Decoder configuration
+    defaults[1uz - 1uz] = 3u;                  // Primary address
+    defaults[8uz - 1uz] = DCC_MANUFACTURER_ID; // Manufacturer ID
+    _store.load(defaults);
+  }
+
+  Store& store() { return _store; }
+  size_t functions() const { return _functions; }
+
+private:
+  void direction(uint16_t, bool) {}
+  void speed(uint16_t, int32_t) {}
+  void function(uint16_t, uint32_t, uint32_t) { ++_functions; }
+  void serviceModeHook(bool) {}
+  void serviceAck() {}
+  void transmitBiDi(std::span<uint8_t const>) {}
+  void error() {}
+  uint8_t readCv(uint32_t cv_addr, uint8_t = 0u) {
+    return _store.readCv(cv_addr);
+  }
+  uint8_t writeCv(uint32_t cv_addr, uint8_t byte) {
+    return _store.writeCv(cv_addr, byte);
+  }
+  bool readCv(uint32_t cv_addr, bool, uint32_t pos) {
+    return readCv(cv_addr) & (1u << pos);
+  }
+  bool writeCv(uint32_t cv_addr, bool bit, uint32_t pos) {
+    auto const mask{1u << pos};
+    auto const byte{readCv(cv_addr)};
+    return writeCv(cv_addr,
+                   static_cast<uint8_t>(bit ? byte | mask : byte & ~mask)) &
+           mask;
+  }
+
+  Store _store;
+  size_t _functions{};
+};
+
+// Command station which records the time between track output edges
+struct CommandStation : dcc::tx::CrtpBase<CommandStation> {
+  friend dcc::tx::CrtpBase<CommandStation>;
+
+  std::vector<uint32_t> record() {
+    std::vector<uint32_t> retval;
+    for (auto i{0uz}; i < packets; ++i) {
+      send(retval, dcc::make_f13_f20_packet(3u, static_cast<uint8_t>(i)));
+      if (i % pom_interval) continue;
+      auto const pom{dcc::make_cv_access_long_write_packet(
+        {.value = 3u, .type = dcc::Address::BasicLoco},
+        3u - 1u,
+        static_cast<uint8_t>(i / pom_interval))};
+      send(retval, pom);
+      send(retval, pom);
+    }
+    return retval;
+  }
+
+private:
+  void send(std::vector<uint32_t>& edges, dcc::Packet const& packet) {
+    this->packet(packet);
+    while (size()) {
+      _time += transmit();
+      if (_edge) edges.push_back(*std::exchange(_edge, std::nullopt));
+    }
+  }
+
+  void trackOutputs(bool, bool) {
+    if (_last) _edge = _time - *_last;
+    _last = _time;
+  }
+
+  uint32_t _time{};
+  std::optional<uint32_t> _last{};
+  std::optional<uint32_t> _edge{};
+};
+
+// Only execute while flash isn't busy
+template<typename Store>
+void run(std::string_view name, std::vector<uint32_t> const& edges) {
+  Flash flash{latencies};
+  Decoder<Store> decoder{flash};
+  decoder.init();
+  auto const writes_before{flash.counters()};
+  std::chrono::microseconds now{};
+  std::chrono::microseconds busy_until{};
+  for (auto const t : edges) {
+    decoder.receive(t);
+    now += std::chrono::microseconds{t};
+    if (now < busy_until) continue;
+    auto const busy{flash.counters().busy};
+    decoder.execute();
+    decoder.store().idle(now);
+    busy_until = now + flash.counters().busy - busy;
+  }
+  auto const& counters{flash.counters()};
+  auto const busy{counters.busy - writes_before.busy};
+  std::printf("%-16.*s %10zu %10zu %10zu %12zu %10.1f\n",
+              static_cast<int>(size(name)),
+              data(name),
+              packets - decoder.functions(),
+              counters.programs - writes_before.programs,
+              counters.erases - writes_before.erases,
+              counters.programmed_bytes - writes_before.programmed_bytes,
+              static_cast<double>(busy.count()) / 1000.0);
+}
+
+} // namespace
+
+int main() {
+  CommandStation command_station;
+  command_station.init();
+  auto const edges{command_station.record()};
+  std::printf("%zu packets, POM write every %zu packets\n",
+              packets,
+              pom_interval);
+  std::printf("%-16s %10s %10s %10s %12s %10s\n",
+              "store",
+              "lost",
+              "programs",
+              "erases",
+              "bytes",
+              "busy [ms]");
+  run<WriteThrough>("write-through", edges);
+  run<Journal>("journal", edges);
+}
@@ -0,0 +1,185 @@
+// Simulate RCN-218 logon of multiple decoders at once
+//
+// Usage: DCCBenchmarkLogon [TRIALS]
+//
+// A command station repeatedly sends LOGON_ENABLE packets to N decoders which
+// all try to answer with app:decoder_unique in the following cutout. If
+// exactly one decoder answers, the command station selects it and assigns an
+// address. If more than one decoder answers, their datagrams collide and are
+// lost. Each trial counts the cutouts until all decoders are registered. The
+// decoder IDs are derived from a fixed seed, so runs are reproducible.
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <dcc/dcc.hpp>
+#include <dcc/rx/cv_store.hpp>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// Numbers of decoders
+constexpr std::array counts{1uz, 2uz, 4uz, 8uz, 16uz, 32uz};
+
+// Give up after that many cutouts
+constexpr size_t max_cutouts{100'000uz};
+
+// Command station and session ID
+constexpr uint16_t cid{0xABCDu};
+constexpr uint8_t sid{1u};
+
+// Decoder which records channel 2 datagrams
+struct Decoder : dcc::rx::CrtpBase<Decoder> {
+  friend dcc::rx::CrtpBase<Decoder>;
+
+  Decoder(uint32_t did) {
+    _cvs.writeCv(29u - 1u, 0b1010u);                // Decoder configuration
+    _cvs.writeCv(28u - 1u, 0b1000'0011u);           // BiDi configuration
+    _cvs.writeCv(1u - 1u, 3u);                      // Primary address
+    _cvs.writeCv(8u - 1u, DCC_MANUFACTURER_ID);     // Manufacturer ID
+    for (auto i{0u}; i < sizeof(did); ++i)          // Decoder ID
+      _cvs.writeCv(DCC_RX_LOGON_DID_CV_ADDRESS + i,
+                   static_cast<uint8_t>(did >> (24u - i * 8u)));
+  }
+
+  // Receive packet and run cutout, return channel 2 datagram
+  std::span<uint8_t const> frame(dcc::tx::Timings const& timings) {
+    _ch2.clear();
+    for (auto const t : timings) receive(t);
+    biDiChannel1();
+    _ch = 2u;
+    biDiChannel2();
+    _ch = 1u;
+    receive(dcc::rx::Timing::Bit1);
+    execute();
+    return _ch2;
+  }
+
+private:
+  void direction(uint16_t, bool) {}
+  void speed(uint16_t, int32_t) {}
+  void function(uint16_t, uint32_t, uint32_t) {}
+  void serviceModeHook(bool) {}
+  void serviceAck() {}
+  void transmitBiDi(std::span<uint8_t const> bytes) {
+    if (_ch == 2u) std::ranges::copy(bytes, std::back_inserter(_ch2));
+  }
+  void error() {}
+  uint8_t readCv(uint32_t cv_addr, uint8_t = 0u) {
+    return _cvs.readCv(cv_addr);
+  }
+  uint8_t writeCv(uint32_t cv_addr, uint8_t byte) {
+    return _cvs.writeCv(cv_addr, byte);
+  }
+  bool readCv(uint32_t cv_addr, bool, uint32_t pos) {
+    return _cvs.readCv(cv_addr, true, pos);
+  }
+  bool writeCv(uint32_t cv_addr, bool bit, uint32_t pos) {
+    return _cvs.writeCv(cv_addr, bit, pos);
+  }
+
+  dcc::rx::CvStore<4uz> _cvs{};
+  std::vector<uint8_t> _ch2;
+  uint8_t _ch{1u};
+};
+
+// Result of a single trial
+struct Trial {
+  size_t cutouts{};    ///< Cutouts until all decoders are registered
+  size_t enables{};    ///< Cutouts following LOGON_ENABLE
+  size_t collisions{}; ///< Cutouts in which multiple decoders answered
+};
+
+// Send packet to all decoders, return channel 2 datagrams of those answering
+std::vector<std::span<uint8_t const>>
+broadcast(std::vector<std::unique_ptr<Decoder>>& decoders,
+          dcc::Packet const& packet) {
+  auto const timings{dcc::tx::packet2timings(packet)};
+  std::vector<std::span<uint8_t const>> retval;
+  for (auto& decoder : decoders)
+    if (auto const ch2{decoder->frame(timings)};
+        !empty(ch2))
+      retval.push_back(ch2);
+  return retval;
+}
+
+// Log on n decoders
+Trial run(size_t n, std::mt19937& gen) {
+  std::vector<std::unique_ptr<Decoder>> decoders;
+  std::uniform_int_distribution<uint32_t> dist;
+  for (auto i{0uz}; i < n; ++i) {
+    decoders.push_back(std::make_unique<Decoder>(dist(gen)));
+    decoders.back()->init();
+  }
+
+  Trial retval{};
+  auto const enable{
+    dcc::make_logon_enable_packet(dcc::LogonGroup::All, cid, sid)};
+  for (auto registered{0uz}; registered < n && retval.cutouts < max_cutouts;) {
+    auto const answers{broadcast(decoders, enable)};
+    ++retval.cutouts;
+    ++retval.enables;
+    if (size(answers) > 1uz) ++retval.collisions;
+    if (size(answers) != 1uz) continue;
+
+    // app:decoder_unique contains the decoder ID in its lower 32 bits
+    dcc::bidi::Datagram<> datagram{};
+    std::ranges::copy_n(
+      cbegin(answers.front()), ssize(datagram), begin(datagram));
+    auto const did{static_cast<uint32_t>(
+      dcc::bidi::make_data(dcc::bidi::decode_datagram(datagram)))};
+
+    // Select and assign
+    broadcast(decoders,
+              dcc::make_logon_select_packet(DCC_MANUFACTURER_ID, did));
+    broadcast(decoders,
+              dcc::make_logon_assign_packet(
+                DCC_MANUFACTURER_ID,
+                did,
+                {.value = static_cast<uint16_t>(1000uz + registered),
+                 .type = dcc::Address::ExtendedLoco}));
+    retval.cutouts += 2uz;
+    ++registered;
+  }
+  return retval;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  auto trials{100uz};
+  if (argc > 1) {
+    std::string_view const arg{argv[1uz]};
+    std::from_chars(data(arg), data(arg) + size(arg), trials);
+    trials = std::max(trials, 1uz);
+  }
+
+  std::mt19937 gen{42u};
+  std::printf("%zu trials per row\n", trials);
+  std::printf("%10s %12s %12s %12s %12s\n",
+              "decoders",
+              "mean",
+              "max",
+              "enables",
+              "collisions");
+  for (auto const n : counts) {
+    std::vector<Trial> results;
+    for (auto i{0uz}; i < trials; ++i) results.push_back(run(n, gen));
+    auto const mean{[&](auto proj) {
+      auto sum{0uz};
+      for (auto const& r : results) sum += std::invoke(proj, r);
+      return static_cast<double>(sum) / static_cast<double>(trials);
+    }};
+    std::printf("%10zu %12.1f %12zu %12.1f %12.1f\n",
+                n,
+                mean(&Trial::cutouts),
+                std::ranges::max(results, {}, &Trial::cutouts).cutouts,
+                mean(&Trial::enables),
+                mean(&Trial::collisions));
+  }
+}
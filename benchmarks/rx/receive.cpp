@@ -0,0 +1,193 @@
+// Benchmark rx::CrtpBase::receive with recorded and synthetic edge streams
+//
+// Usage: DCCBenchmarkReceive [FILE]
+//
+// FILE optionally contains a recorded edge stream as whitespace separated
+// durations in µs (e.g. captured by a logic analyzer).
+
+#include <algorithm>
+#include <dcc/dcc.hpp>
+#include <fstream>
+#include <random>
+#include <vector>
+#include "../benchmark.hpp"
+
+namespace {
+
+// Total number of edges per stream
+constexpr size_t edges{10'000'000uz};
+
+// Decoder without any side effects
+struct Decoder : dcc::rx::CrtpBase<Decoder> {
+  friend dcc::rx::CrtpBase<Decoder>;
+
+  Decoder() {
+    _cvs[29uz - 1uz] = 0b1010u;            // Decoder configuration
+    _cvs[28uz - 1uz] = 0b11u;              // BiDi configuration
+    _cvs[1uz - 1uz] = 3u;                  // Primary address
+    _cvs[8uz - 1uz] = DCC_MANUFACTURER_ID; // Manufacturer ID
+  }
+
+private:
+  void direction(uint16_t, bool) {}
+  void speed(uint16_t, int32_t) {}
+  void function(uint16_t, uint32_t, uint32_t) {}
+  void serviceModeHook(bool) {}
+  void serviceAck() {}
+  void transmitBiDi(std::span<uint8_t const>) {}
+  void error() {}
+  uint8_t readCv(uint32_t cv_addr, uint8_t = 0u) {
+    return cv_addr < size(_cvs) ? _cvs[cv_addr] : 0u;
+  }
+  uint8_t writeCv(uint32_t cv_addr, uint8_t byte) {
+    return cv_addr < size(_cvs) ? _cvs[cv_addr] = byte : byte;
+  }
+  bool readCv(uint32_t cv_addr, bool, uint32_t pos) {
+    return readCv(cv_addr) & (1u << pos);
+  }
+  bool writeCv(uint32_t cv_addr, bool bit, uint32_t pos) {
+    auto const byte{readCv(cv_addr)};
+    return writeCv(cv_addr,
+                   static_cast<uint8_t>((byte & ~(1u << pos)) | (bit << pos))) &
+           (1u << pos);
+  }
+
+  std::array<uint8_t, 1024uz> _cvs{};
+};
+
+// Command station which records the time between track output edges
+struct CommandStation : dcc::tx::CrtpBase<CommandStation> {
+  friend dcc::tx::CrtpBase<CommandStation>;
+
+  std::vector<uint32_t> record(size_t n) {
+    std::vector<uint32_t> retval;
+    retval.reserve(n);
+    std::array const packets{
+      dcc::make_128_speed_step_control_packet(3u, 1u << 7u | 42u),
+      dcc::make_f0_f4_packet(3u, 0b1'0101u),
+      dcc::make_128_speed_step_control_packet(
+        {.value = 1000u, .type = dcc::Address::ExtendedLoco}, 100u),
+      dcc::make_idle_packet(),
+      dcc::make_cv_access_long_write_packet(
+        {.value = 42u, .type = dcc::Address::BasicLoco}, 8u - 1u, 8u),
+    };
+    auto it{std::cbegin(packets)};
+    while (std::size(retval) < n) {
+      if (!size()) {
+        packet(*it);
+        if (++it == std::cend(packets)) it = std::cbegin(packets);
+      }
+      _time += transmit();
+      if (_edge) retval.push_back(*std::exchange(_edge, std::nullopt));
+    }
+    return retval;
+  }
+
+private:
+  void trackOutputs(bool, bool) {
+    if (_last) _edge = _time - *_last;
+    _last = _time;
+  }
+
+  uint32_t _time{};
+  std::optional<uint32_t> _last{};
+  std::optional<uint32_t> _edge{};
+};
+
+// Stream recorded from command station with BiDi cutouts
+std::vector<uint32_t> command_station_stream() {
+  CommandStation command_station;
+  command_station.init({.flags = {.bidi = true}});
+  return command_station.record(edges);
+}
+
+// Valid packets with random bit durations within receiver tolerances
+std::vector<uint32_t> jitter_stream() {
+  std::mt19937 gen{42u};
+  std::uniform_int_distribution<uint32_t> bit1{dcc::rx::Bit1Min,
+                                               dcc::rx::Bit1Max};
+  std::uniform_int_distribution<uint32_t> bit0{dcc::rx::Bit0Min,
+                                               dcc::rx::Bit0Max};
+  std::uniform_int_distribution<uint32_t> byte{0u, 255u};
+  std::vector<uint32_t> retval;
+  retval.reserve(edges);
+  auto push_bit{[&](bool bit) {
+    retval.push_back(bit ? bit1(gen) : bit0(gen));
+    retval.push_back(bit ? bit1(gen) : bit0(gen));
+  }};
+  while (size(retval) < edges) {
+    for (auto i{0uz}; i < DCC_RX_MIN_PREAMBLE_BITS + 2uz; ++i) push_bit(true);
+    dcc::Packet packet{static_cast<uint8_t>(byte(gen) & 0x7Fu),
+                       static_cast<uint8_t>(byte(gen))};
+    packet.push_back(dcc::exor(std::span{packet}));
+    for (auto const b : packet) {
+      push_bit(false);
+      for (auto i{CHAR_BIT}; i-- > 0;) push_bit(b & (1u << i));
+    }
+    push_bit(true);
+  }
+  return retval;
+}
+
+// Random durations, mostly invalid bits
+std::vector<uint32_t> noise_stream() {
+  std::mt19937 gen{42u};
+  std::uniform_int_distribution<uint32_t> dist{0u, 200u};
+  std::vector<uint32_t> retval(edges);
+  for (auto& t : retval) t = dist(gen);
+  return retval;
+}
+
+// Stream recorded to file
+std::vector<uint32_t> recorded_stream(char const* path) {
+  std::ifstream ifs{path};
+  std::vector<uint32_t> recorded;
+  for (uint32_t t; ifs >> t;) recorded.push_back(t);
+  if (empty(recorded)) return recorded;
+  std::vector<uint32_t> retval;
+  retval.reserve(edges);
+  while (size(retval) < edges)
+    for (auto const t : recorded) retval.push_back(t);
+  return retval;
+}
+
+void run(std::string_view name, std::vector<uint32_t> const& stream) {
+  if (empty(stream)) return;
+  Decoder decoder;
+  decoder.init();
+  auto const result{measure(size(stream), [&] {
+    for (auto const t : stream) decoder.receive(t);
+  })};
+  print(name, size(stream), result);
+}
+
+// Pass stream in chunks like from a DMA buffer
+void run_buffered(std::string_view name,
+                  std::vector<uint32_t> const& stream,
+                  size_t chunk_size) {
+  if (empty(stream)) return;
+  Decoder decoder;
+  decoder.init();
+  auto const result{measure(size(stream), [&] {
+    for (std::span<uint32_t const> times{stream}; !empty(times);) {
+      auto chunk{times.first(std::min(chunk_size, size(times)))};
+      times = times.subspan(size(chunk));
+      while (!empty(chunk)) chunk = chunk.subspan(decoder.receive(chunk));
+    }
+  })};
+  print(name, size(stream), result);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  std::printf("DCC_RX_TABLE_DRIVEN_RECEIVE=%d\n", DCC_RX_TABLE_DRIVEN_RECEIVE);
+  std::printf(
+    "%-24s %10s %10s %12s\n", "stream", "edges", "ns/edge", "instr/edge");
+  auto const command_station{command_station_stream()};
+  run("command station", command_station);
+  run_buffered("command station (64)", command_station, 64uz);
+  run("jitter", jitter_stream());
+  run("noise", noise_stream());
+  if (argc > 1) run("recorded", recorded_stream(argv[1]));
+}
@@ -7,9 +7,9 @@
   std::cout << std::flush
 
 Decoder::Decoder() {
-  _cvs[29uz - 1uz] = 0b10u;              // Decoder configuration
-  _cvs[1uz - 1uz] = 3u;                  // Primary address
-  _cvs[8uz - 1uz] = DCC_MANUFACTURER_ID; // Manufacturer ID
+  _cvs.writeCv(29u - 1u, 0b10u);              // Decoder configuration
+  _cvs.writeCv(1u - 1u, 3u);                  // Primary address
+  _cvs.writeCv(8u - 1u, DCC_MANUFACTURER_ID); // Manufacturer ID
 }
 
 void Decoder::direction(uint16_t addr, bool dir) {
@@ -42,8 +42,7 @@ void Decoder::transmitBiDi(std::span<uint8_t const>) {}
 void Decoder::error() {}
 
 uint8_t Decoder::readCv(uint32_t cv_addr, [[maybe_unused]] uint8_t byte) {
-  auto const red_byte{
-    static_cast<uint8_t>(cv_addr < size(_cvs) ? _cvs[cv_addr] : 0u)};
+  auto const red_byte{_cvs.readCv(cv_addr)};
   cli::Cli::cout() << "Read CV byte " << cv_addr
                    << "==" << static_cast<uint32_t>(red_byte) << PROMPTENDL;
   return red_byte;
@@ -52,22 +51,18 @@ uint8_t Decoder::readCv(uint32_t cv_addr, [[maybe_unused]] uint8_t byte) {
 uint8_t Decoder::writeCv(uint32_t cv_addr, uint8_t byte) {
   cli::Cli::cout() << "Write CV byte " << cv_addr << "="
                    << static_cast<uint32_t>(byte) << PROMPTENDL;
-  return _cvs[cv_addr] = byte;
+  return _cvs.writeCv(cv_addr, byte);
 }
 
-bool Decoder::readCv(uint32_t cv_addr,
-                     [[maybe_unused]] bool bit,
-                     uint32_t pos) {
-  auto const red_bit{static_cast<bool>(_cvs[cv_addr] & (1u << pos))};
+bool Decoder::readCv(uint32_t cv_addr, bool bit, uint32_t pos) {
+  auto const red_bit{_cvs.readCv(cv_addr, bit, pos)};
   cli::Cli::cout() << "Read CV bit " << cv_addr << ":" << pos << "==" << red_bit
                    << PROMPTENDL;
   return red_bit;
 }
 
 bool Decoder::writeCv(uint32_t cv_addr, bool bit, uint32_t pos) {
-  _cvs[cv_addr] =
-    static_cast<uint8_t>((_cvs[cv_addr] & ~(1u << pos)) | (bit << pos));
-  auto const red_bit{static_cast<bool>(_cvs[cv_addr] & (1u << pos))};
+  auto const red_bit{_cvs.writeCv(cv_addr, bit, pos)};
   cli::Cli::cout() << "Write CV bit " << cv_addr << ":" << pos << "=" << red_bit
                    << PROMPTENDL;
   return red_bit;
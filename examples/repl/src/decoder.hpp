@@ -1,6 +1,7 @@
 #pragma once
 
 #include <dcc/dcc.hpp>
+#include <dcc/rx/cv_store.hpp>
 
 struct Decoder : dcc::rx::CrtpBase<Decoder> {
   friend dcc::rx::CrtpBase<Decoder>;
@@ -41,5 +42,5 @@ private:
   // Write CV bit
   bool writeCv(uint32_t cv_addr, bool bit, uint32_t pos);
 
-  std::array<uint8_t, 1024uz> _cvs{};
+  dcc::rx::CvStore<8uz> _cvs;
 };
@@ -27,7 +27,7 @@ void decoder_task() {
   // Continuously call execute
   for (;;) {
     std::this_thread::sleep_for(5ms);
-    decoder.execute();
+    decoder.execute(DCC_RX_DEQUE_SIZE);
   }
 }
 
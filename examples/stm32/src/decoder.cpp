@@ -63,7 +63,7 @@ int main() {
 
   printf("\n\nBoot\n");
   for (;;) {
-    decoder.execute();
+    decoder.execute(DCC_RX_DEQUE_SIZE);
     bsp_delay(5u);
   }
 }
@@ -0,0 +1,30 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Aggregated functions
+///
+/// \file   dcc/rx/aggregated_functions.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <bitset>
+#include <concepts>
+#include <cstdint>
+#include "../address.hpp"
+
+namespace dcc::rx {
+
+/// Functions F0-F68, bit n corresponds to Fn
+using Functions = std::bitset<69uz>;
+
+/// Functions F0-F68 in a single callback
+template<typename T>
+concept AggregatedFunctions =
+  requires(T t, Address::value_type addr, Functions mask, Functions state) {
+    { t.functions(addr, mask, state) } -> std::same_as<void>;
+  };
+
+} // namespace dcc::rx
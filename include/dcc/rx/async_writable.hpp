@@ -12,14 +12,14 @@
 
 #include <concepts>
 #include <cstdint>
-#include <functional>
+#include "cv_callback.hpp"
 
 namespace dcc::rx {
 
 template<typename T>
-concept AsyncWritable = requires(
-  T t, uint32_t cv_addr, uint8_t byte, std::function<void(uint8_t)> cb) {
-  { t.writeCv(cv_addr, byte, cb) };
-};
+concept AsyncWritable =
+  requires(T t, uint32_t cv_addr, uint8_t byte, CvCallback cb) {
+    { t.writeCv(cv_addr, byte, cb) };
+  };
 
 } // namespace dcc::rx
@@ -13,12 +13,57 @@
 #include <algorithm>
 #include <climits>
 #include <cstdint>
-#include <cstdlib>
+#include <limits>
+#include <random>
 
 namespace dcc::rx {
 
+/// Xorshift32 pseudo random number generator
+///
+/// Tiny and reentrant replacement for rand(). A seed of 0 would get stuck and
+/// is therefore replaced by a default seed.
+struct Xorshift32 {
+  using result_type = uint32_t;
+
+  static constexpr result_type default_seed{2463534242u};
+
+  constexpr Xorshift32() = default;
+  constexpr explicit Xorshift32(result_type value) { seed(value); }
+
+  /// Seed generator
+  ///
+  /// \param  value Seed
+  constexpr void seed(result_type value) {
+    _state = value ? value : default_seed;
+  }
+
+  /// Get next random number
+  ///
+  /// \return Random number
+  constexpr result_type operator()() {
+    _state ^= _state << 13u;
+    _state ^= _state >> 17u;
+    _state ^= _state << 5u;
+    return _state;
+  }
+
+  static constexpr result_type min() { return 1u; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  result_type _state{default_seed};
+};
+
 /// Implements O(2^n) backoff logic
-struct Backoff {
+///
+/// \tparam G Random number generator
+template<std::uniform_random_bit_generator G>
+struct BasicBackoff {
+  constexpr BasicBackoff() = default;
+  constexpr explicit BasicBackoff(G gen) : _gen{gen} {}
+
   constexpr operator bool() {
     if (_count) {
       --_count;
@@ -31,18 +76,27 @@ struct Backoff {
   }
 
   /// Don't backoff next time
-  void now() {
+  constexpr void now() {
     _range = 0;
     _count = 0u;
   }
 
+  /// Get random number generator
+  ///
+  /// \return Random number generator
+  constexpr G& generator() { return _gen; }
+
 private:
-  uint8_t randomCount() const {
-    return static_cast<decltype(_count)>(rand() % (CHAR_BIT << _range));
+  constexpr uint8_t randomCount() {
+    return static_cast<decltype(_count)>(
+      (_gen() - G::min()) % static_cast<uint32_t>(CHAR_BIT << _range));
   }
 
+  G _gen{};
   int8_t _range{};
   uint8_t _count{};
 };
 
+using Backoff = BasicBackoff<Xorshift32>;
+
 } // namespace dcc::rx
@@ -0,0 +1,30 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Block readable
+///
+/// \file   dcc/rx/block_readable.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+namespace dcc::rx {
+
+/// Read 4 byte chunks of a block (RCN-218 logon select)
+///
+/// readBlock gets called in handler mode (interrupt context) and its result
+/// has to be ready before the following cutout. It must not block and should
+/// only access RAM, returning false answers with NAKs.
+template<typename T>
+concept BlockReadable =
+  requires(T t, uint16_t index, std::span<uint8_t, 4uz> bytes) {
+    { t.readBlock(index, bytes) } -> std::same_as<bool>;
+  };
+
+} // namespace dcc::rx
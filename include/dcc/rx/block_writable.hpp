@@ -0,0 +1,31 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Block writable
+///
+/// \file   dcc/rx/block_writable.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+namespace dcc::rx {
+
+/// Write 4 byte chunks of a block (RCN-218 logon select)
+///
+/// writeBlock gets called in handler mode (interrupt context) and its result
+/// has to be ready before the following cutout. It must not block and should
+/// only write RAM, flash has to be programmed later in thread mode. Returning
+/// false answers with NAKs.
+template<typename T>
+concept BlockWritable =
+  requires(T t, uint16_t index, std::span<uint8_t const, 4uz> bytes) {
+    { t.writeBlock(index, bytes) } -> std::same_as<bool>;
+  };
+
+} // namespace dcc::rx
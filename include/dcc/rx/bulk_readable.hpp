@@ -0,0 +1,25 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Bulk readable
+///
+/// \file   dcc/rx/bulk_readable.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+namespace dcc::rx {
+
+template<typename T>
+concept BulkReadable =
+  requires(T t, uint32_t cv_addr, std::span<uint8_t> bytes) {
+    { t.readCvs(cv_addr, bytes) } -> std::same_as<void>;
+  };
+
+} // namespace dcc::rx
@@ -0,0 +1,55 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Free-running timer capture
+///
+/// \file   dcc/rx/capture.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace dcc::rx {
+
+/// Convert captures of a free-running timer into times between edges
+///
+/// The counter wraps around after Top. The time between two edges must
+/// therefore be shorter than a whole timer period.
+///
+/// \tparam Counter Type of timer counter
+/// \tparam Top     Highest counter value before wraparound
+template<std::unsigned_integral Counter = uint32_t,
+         Counter Top = std::numeric_limits<Counter>::max()>
+struct Capture {
+  /// Get time since last capture
+  ///
+  /// \param  timestamp Captured counter value
+  /// \return Time since last capture in timer ticks
+  constexpr uint32_t operator()(Counter timestamp) {
+    auto const retval{
+      timestamp >= _last
+        ? static_cast<uint32_t>(timestamp - _last)
+        : static_cast<uint32_t>(static_cast<uint32_t>(Top - _last) + 1u +
+                                timestamp)};
+    _last = timestamp;
+    return retval;
+  }
+
+  /// Replace captures by times since previous capture in-place
+  ///
+  /// \param  timestamps  Captured counter values
+  constexpr void operator()(std::span<uint32_t> timestamps) {
+    for (auto& t : timestamps) t = (*this)(static_cast<Counter>(t));
+  }
+
+private:
+  Counter _last{}; ///< Last captured counter value
+};
+
+} // namespace dcc::rx
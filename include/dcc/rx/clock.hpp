@@ -0,0 +1,47 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Monotonic clock
+///
+/// \file   dcc/rx/clock.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <ratio>
+
+namespace dcc::rx {
+
+/// Monotonic clock with 32 bit millisecond ticks
+///
+/// Differences between time points stay correct across wrap-around as long as
+/// they are shorter than about 49 days.
+struct Clock {
+  using rep = uint32_t;
+  using period = std::milli;
+  using duration = std::chrono::duration<rep, period>;
+  using time_point = std::chrono::time_point<Clock>;
+  static constexpr bool is_steady{true};
+
+  /// Get current time point derived from std::chrono::steady_clock
+  ///
+  /// \return Current time point
+  static time_point now() {
+    return time_point{duration{static_cast<rep>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count())}};
+  }
+};
+
+template<typename T>
+concept Clocked = requires(T t) {
+  { t.now() } -> std::same_as<uint32_t>;
+};
+
+} // namespace dcc::rx
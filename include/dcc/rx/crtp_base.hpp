@@ -10,12 +10,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <concepts>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <ratio>
 #include <span>
 #include <ztl/bits.hpp>
 #include <ztl/inplace_deque.hpp>
+#include <ztl/inplace_vector.hpp>
 #include "../bidi/acks.hpp"
 #include "../bidi/channel.hpp"
 #include "../bidi/datagram.hpp"
@@ -32,19 +40,33 @@
 #include "../speed.hpp"
 #include "../utility.hpp"
 #include "addresses.hpp"
+#include "aggregated_functions.hpp"
 #include "async_readable.hpp"
 #include "async_writable.hpp"
 #include "backoff.hpp"
+#include "block_readable.hpp"
+#include "block_writable.hpp"
+#include "bulk_readable.hpp"
+#include "bulk_writable.hpp"
+#include "capture.hpp"
+#include "clock.hpp"
 #include "decoder.hpp"
 #include "east_west.hpp"
+#include "snapshot.hpp"
+#include "spsc_queue.hpp"
+#include "telemetry.hpp"
 #include "timing.hpp"
 
 namespace dcc::rx {
 
 /// CRTP base for receiving DCC
 ///
-/// \tparam T Type to downcast to
-template<typename T>
+/// \tparam T       Type to downcast to
+/// \tparam Period  Duration of a timer tick in seconds
+/// \tparam G       Random number generator of logon and search backoffs
+template<typename T,
+         typename Period = std::micro,
+         std::uniform_random_bit_generator G = Xorshift32>
 struct CrtpBase {
   friend T;
 
@@ -52,69 +74,115 @@ struct CrtpBase {
   void init() {
     // Primary address
     auto const cv29{impl().readCv(29u - 1u)};
-    if (cv29 & ztl::mask<5u>) {
-      std::array const cv17_cv18{impl().readCv(17u - 1u),
-                                 impl().readCv(18u - 1u)};
-      _addrs.primary = decode_address(cv17_cv18);
-    } else {
-      auto const cv1{impl().readCv(1u - 1u)};
-      _addrs.primary = decode_address(&cv1);
-    }
-    _addrs.primary.reversed = cv29 & ztl::mask<0u>;
+    derivePrimaryAddress(cv29);
 
     // Consist address
     auto const cv19{impl().readCv(19u - 1u)};
     auto const cv20{impl().readCv(20u - 1u)};
-    auto const consist_addr{100u * (cv20 & 0b0111'1111u) +
-                            (cv19 & 0b0111'1111u)};
-    _addrs.consist = {static_cast<Address::value_type>(consist_addr),
-                      consist_addr <= 127u ? Address::BasicLoco
-                                           : Address::ExtendedLoco};
-    _addrs.consist.reversed = cv19 & ztl::mask<7u>;
+    deriveConsistAddress(cv19, cv20);
 
     // Legacy exception for F0
-    _f0_exception = !(cv29 & ztl::mask<1u>);
+    deriveF0Exception(cv29);
 
     // Decoder lock
     auto const cv15{impl().readCv(15u - 1u)};
     auto const cv16{impl().readCv(16u - 1u)};
-    _cvs_locked = cv15 != cv16 && cv15 && cv16;
+    deriveDecoderLock(cv15, cv16);
 
     // BiDi
-    auto const bidi_enabled{static_cast<bool>(cv29 & ztl::mask<3u>)};
-    auto const ch2_consist_enabled{static_cast<bool>(cv20 & ztl::mask<7u>)};
     auto const cv28{impl().readCv(28u - 1u)};
-    _ch1_addr_enabled = bidi_enabled && (cv28 & ztl::mask<0u>);
-    _ch2_data_enabled = bidi_enabled && (cv28 & ztl::mask<1u>);
-    _logon_enabled = bidi_enabled && (cv28 & ztl::mask<7u>);
-    _ch2_consist_enabled = bidi_enabled && ch2_consist_enabled;
+    deriveBiDi(cv20, cv28, cv29);
 
     // IDs
-    _ids.decoder = {impl().readCv(DCC_RX_LOGON_DID_CV_ADDRESS + 0u),
-                    impl().readCv(DCC_RX_LOGON_DID_CV_ADDRESS + 1u),
-                    impl().readCv(DCC_RX_LOGON_DID_CV_ADDRESS + 2u),
-                    impl().readCv(DCC_RX_LOGON_DID_CV_ADDRESS + 3u)};
+    bulkRead(DCC_RX_LOGON_DID_CV_ADDRESS, _ids.decoder);
+    std::array<uint8_t, 2uz> cid_cvs;
+    bulkRead(DCC_RX_LOGON_CID_CV_ADDRESS, cid_cvs);
     _ids.cs.front() = static_cast<decltype(_ids.cs)::value_type>(
-      static_cast<uint32_t>(impl().readCv(DCC_RX_LOGON_CID_CV_ADDRESS + 0u))
-        << 8u |
-      impl().readCv(DCC_RX_LOGON_CID_CV_ADDRESS + 1u));
+      static_cast<uint32_t>(cid_cvs[0uz]) << 8u | cid_cvs[1uz]);
     _ids.session.front() = impl().readCv(DCC_RX_LOGON_SID_CV_ADDRESS);
+    deriveDecoderUnique();
+    seedBackoffs();
 
     // Logon address
-    std::array const logon_addr_cvs{
-      impl().readCv(DCC_RX_LOGON_ADDRESS_CV_ADDRESS + 0u),
-      impl().readCv(DCC_RX_LOGON_ADDRESS_CV_ADDRESS + 1u)};
+    std::array<uint8_t, 2uz> logon_addr_cvs;
+    bulkRead(DCC_RX_LOGON_ADDRESS_CV_ADDRESS, logon_addr_cvs);
     _addrs.logon = decode_address(logon_addr_cvs);
+    updateFilter();
 
-    // Initialization time point
-    _tps.init = std::chrono::system_clock::now();
+    invalidate();
+  }
 
-    // Clear deques
-    _deques.dyn.clear();
-    _deques.logon.clear();
-    _deques.search.clear();
-    _deques.adr.clear();
-    _deques.pom.clear();
+  /// Initialize from snapshot
+  ///
+  /// Falls back to reading CVs if the checksum of the snapshot doesn't match
+  /// or if the CVs have been written since the snapshot was taken.
+  ///
+  /// \param  snapshot  Snapshot
+  /// \param  revision  Current revision of CVs
+  /// \retval true      Initialized from snapshot
+  /// \retval false     Initialized from CVs
+  bool init(Snapshot const& snapshot, uint32_t revision) {
+    if (snapshot.crc != checksum(snapshot) || snapshot.revision != revision) {
+      init();
+      return false;
+    }
+    _addrs.primary = snapshot.primary;
+    _addrs.consist = snapshot.consist;
+    _addrs.logon = snapshot.logon;
+    _ids.decoder = snapshot.did;
+    _ids.cs.front() = snapshot.cid;
+    _ids.session.front() = snapshot.sid;
+    _ch1_addr_enabled = snapshot.flags & Snapshot::Ch1AddrEnabled;
+    _ch2_data_enabled = snapshot.flags & Snapshot::Ch2DataEnabled;
+    _ch2_consist_enabled = snapshot.flags & Snapshot::Ch2ConsistEnabled;
+    _logon_enabled = snapshot.flags & Snapshot::LogonEnabled;
+    _cvs_locked = snapshot.flags & Snapshot::CvsLocked;
+    _f0_exception = snapshot.flags & Snapshot::F0Exception;
+    deriveShortInfo();
+    deriveDecoderUnique();
+    seedBackoffs();
+    updateFilter();
+    invalidate();
+    return true;
+  }
+
+  /// Get snapshot of configuration derived from CVs
+  ///
+  /// The revision has to identify the current content of the CVs, e.g. a write
+  /// counter which the CV storage persists together with the CVs.
+  ///
+  /// \param  revision  Current revision of CVs
+  /// \return Snapshot
+  Snapshot snapshot(uint32_t revision) const {
+    Snapshot snapshot{
+      .primary = _addrs.primary,
+      .consist = _addrs.consist,
+      .logon = _addrs.logon,
+      .did = _ids.decoder,
+      .cid = _ids.cs.front(),
+      .sid = _ids.session.front(),
+      .revision = revision};
+    if (_ch1_addr_enabled) snapshot.flags |= Snapshot::Ch1AddrEnabled;
+    if (_ch2_data_enabled) snapshot.flags |= Snapshot::Ch2DataEnabled;
+    if (_ch2_consist_enabled) snapshot.flags |= Snapshot::Ch2ConsistEnabled;
+    if (_logon_enabled) snapshot.flags |= Snapshot::LogonEnabled;
+    if (_cvs_locked) snapshot.flags |= Snapshot::CvsLocked;
+    if (_f0_exception) snapshot.flags |= Snapshot::F0Exception;
+    snapshot.crc = checksum(snapshot);
+    return snapshot;
+  }
+
+  /// Check whether snapshot is outdated
+  ///
+  /// Derived configuration changes with writes to its source CVs and with
+  /// logon assignments. A snapshot which no longer matches the current
+  /// configuration has to be retaken.
+  ///
+  /// \param  snapshot  Snapshot
+  /// \retval true      Snapshot outdated
+  /// \retval false     Snapshot up to date
+  bool snapshotOutdated(Snapshot const& snapshot) const {
+    return this->snapshot(snapshot.revision) != snapshot;
   }
 
   /// Enable
@@ -132,69 +200,27 @@ struct CrtpBase {
 
   /// Encoding of commands bit by bit
   ///
-  /// \param  time  Time in µs
+  /// \param  time  Time in timer ticks
   void receive(uint32_t time) {
-    // Whatever we got, its not packet end anymore
-    _packet_end = false;
-
-    // Count consecutive one bits to determine if preamble is valid
-    auto const bit{time2bit(time)};
-    bool const valid_preamble{_counts.one_bit >=
-                              DCC_RX_MIN_PREAMBLE_BITS * 2uz};
-    _counts.one_bit = bit == _1 ? (_counts.one_bit + 1uz) : 0uz;
-
-    // Reset if bit invalid
-    if (bit == Invalid) return reset();
-
-    // Alternate halfbit <-> bit
-    if (_state > Startbit && (_is_halfbit = !_is_halfbit)) return;
-
-    // Successfully received a bit
-    switch (_state) {
-      case Preamble:
-        if (bit) return;
-        else if (valid_preamble) _state = Startbit;
-        else return reset();
-        break;
-
-      case Startbit:
-        _packets.current.clear();
-        _counts.bit = 0uz;
-        _is_halfbit = false;
-        ++_counts.preamble;
-        _state = Data;
-        break;
-
-      case Data:
-        _byte = static_cast<uint8_t>((_byte << 1u) | bit);
-        if (++_counts.bit < CHAR_BIT) return;
-        _packets.current.push_back(_byte);
-        _checksum = static_cast<uint8_t>(_checksum ^ _byte);
-        _counts.bit = _byte = 0u;
-        _state = Endbit;
-        break;
+    if constexpr (DCC_RX_TABLE_DRIVEN_RECEIVE) receiveTable(time);
+    else receiveSwitch(time);
+  }
 
-      case Endbit:
-        if (!bit) {
-          _state = Data;
-          return;
-        }
-        // Execute or push back valid packet
-        else if (!_checksum && size(_packets.current) >= 3uz) {
-          _packet_end = true;
-          ++_counts.packet;
-          _addrs.received = decode_address(_packets.current);
-          _instr = decode_instruction(_packets.current);
-          if (!executeHandlerMode() && !full(_deques.packet))
-            _deques.packet.push_back(_packets.current);
-        }
-        // Immediately clear received address and invalid packet
-        else {
-          _addrs.received = {};
-          _packets.current.clear();
-        }
-        reset();
+  /// Encoding of commands from a buffer of times
+  ///
+  /// Stops right after a packet end, so that packetEnd() and the following
+  /// BiDi cutout can be handled before passing the remaining times again.
+  ///
+  /// \param  times Times in timer ticks
+  /// \return Number of consumed times
+  size_t receive(std::span<uint32_t const> times) {
+    auto first{cbegin(times)};
+    auto const last{cend(times)};
+    while (first != last) {
+      receive(*first++);
+      if (packetEnd()) break;
     }
+    return static_cast<size_t>(first - cbegin(times));
   }
 
   /// Execute received commands
@@ -203,11 +229,39 @@ struct CrtpBase {
   /// \retval false Command not executed
   bool execute() { return executeThreadMode(); }
 
+  /// Execute up to a number of received commands
+  ///
+  /// Other than calling execute() repeatedly, housekeeping (e.g. QoS) only
+  /// runs once per call.
+  ///
+  /// \param  budget  Maximum number of commands
+  /// \return Number of commands taken from deque
+  size_t execute(size_t budget) {
+    return executeThreadMode([&budget] {
+      if (!budget) return false;
+      --budget;
+      return true;
+    });
+  }
+
+  /// Execute received commands until deadline
+  ///
+  /// \tparam Clock     Clock of deadline
+  /// \tparam Duration  Duration of deadline
+  /// \param  deadline  Time point after which no more commands are executed
+  /// \return Number of commands taken from deque
+  template<typename Clock, typename Duration>
+  size_t execute(std::chrono::time_point<Clock, Duration> deadline) {
+    return executeThreadMode([deadline] { return Clock::now() < deadline; });
+  }
+
   /// Service mode
   ///
   /// \retval true  Service mode active
   /// \retval false Operations mode active
-  bool serviceMode() const { return _mode == Service; }
+  bool serviceMode() const {
+    return _mode.load(std::memory_order_relaxed) == Service;
+  }
 
   /// MAN function
   ///
@@ -219,13 +273,36 @@ struct CrtpBase {
   ///
   /// \retval true  Last received bit was packet end
   /// \retval false Last received bit wasn't packet end
-  bool packetEnd() const { return _packet_end; }
+  bool packetEnd() const {
+    return _packet_end.load(std::memory_order_relaxed);
+  }
 
   /// Addresses
   ///
   /// \return Addresses
   Addresses const& addresses() const { return _addrs; }
 
+  /// Suppress direction, speed and function callbacks with unchanged values
+  ///
+  /// Values are cached separately for primary, consist and logon address.
+  ///
+  /// \param  enable  Enable suppression
+  void suppressUnchanged(bool enable) {
+    _suppress_unchanged = enable;
+    _callback_states = {};
+  }
+
+  /// Counts of delivered and suppressed callbacks
+  struct CallbackCounts {
+    size_t delivered{};  ///< Delivered callbacks
+    size_t suppressed{}; ///< Suppressed callbacks
+  };
+
+  /// Get counts of delivered and suppressed callbacks
+  ///
+  /// \return Counts of delivered and suppressed callbacks
+  CallbackCounts const& callbackCounts() const { return _callback_counts; }
+
   /// Add dyn (ID7) datagrams to deque
   ///
   /// \tparam Dyns... Types of dyn datagrams
@@ -234,7 +311,7 @@ struct CrtpBase {
   void datagram(Dyns&&... dyns) {
     // Block full and release empty deque to avoid getting the same datagrams
     // send over and over again...
-    if (full(_deques.dyn)) _block_dyn_deque = true;
+    if (dynCount() == DCC_RX_BIDI_DEQUE_SIZE) _block_dyn_deque = true;
     else if (empty(_deques.dyn)) {
       _block_dyn_deque = false;
       dyn(_qos, 7u);
@@ -244,6 +321,13 @@ struct CrtpBase {
     if (!_block_dyn_deque) (dyn(dyns.d, dyns.x), ...);
   }
 
+  /// Telemetry scheduler
+  ///
+  /// Due sources get pulled whenever the dyn deque runs empty.
+  ///
+  /// \return Telemetry scheduler
+  Telemetry<DCC_RX_TELEMETRY_SIZE>& telemetry() { return _telemetry; }
+
   /// Start channel1 (12 bit payload)
   void biDiChannel1() {
     if (!packetEnd()) return;
@@ -278,6 +362,22 @@ struct CrtpBase {
   }
 
 private:
+  /// Received packet with decoded address
+  struct AddressedPacket {
+    Packet packet{};
+    Address addr{};
+  };
+
+  /// Cached callback values of an address
+  struct CallbackState {
+    int32_t speed{};
+    Functions functions{};
+    Functions known_functions{}; ///< Mask of functions with known state
+    bool dir{};
+    bool known_speed{};
+    bool known_dir{};
+  };
+
   constexpr CrtpBase() = default;
   Decoder auto& impl() { return static_cast<T&>(*this); }
   Decoder auto const& impl() const { return static_cast<T const&>(*this); }
@@ -288,7 +388,7 @@ private:
   /// \retval false Command not executed
   bool executeHandlerMode() {
     if (_addrs.received.type == Address::AutomaticLogon)
-      return executeOperations(_addrs.received, _packets.current, true);
+      return executeOperations(_addrs.received, _current->packet, true);
     else return false;
   }
 
@@ -297,13 +397,51 @@ private:
   /// \retval true  Command executed
   /// \retval false Command not executed
   bool executeThreadMode() {
-    if (packetEnd() || empty(_deques.packet)) return false;
+    return housekeeping() && !empty(_deques.packet) && executeFront();
+  }
+
+  /// Execute in thread mode as long as allowed
+  ///
+  /// \param  more  Predicate which allows another command
+  /// \return Number of commands taken from deque
+  size_t executeThreadMode(std::predicate auto&& more) {
+    if (!housekeeping()) return 0uz;
+    auto count{0uz};
+    // Stop if a cutout begins in the meantime
+    while (!packetEnd() && !empty(_deques.packet) && more()) {
+      executeFront();
+      ++count;
+    }
+    return count;
+  }
+
+  /// Housekeeping of thread mode
+  ///
+  /// \retval true  Packets received since last call
+  /// \retval false Packet end or nothing received
+  bool housekeeping() {
+    if (packetEnd()) return false;
+    // Filtered packets still count as received
+    else if (auto const filtered{_counts.filtered.load(
+               std::memory_order_relaxed)};
+             empty(_deques.packet) &&
+             filtered == std::exchange(_seen.filtered, filtered))
+      return false;
+    syncFilter();       // Update filter if logon changed addresses
     adr();              // Prepare address broadcasts for BiDi channel 1
     logonStore();       // Store logon information if necessary
     updateQos();        // Update quality of service
     updateTimePoints(); // Update time points for tip-off search
-    auto const& packet{_deques.packet.front()};
-    auto const addr{decode_address(packet)};
+    pullTelemetry();    // Fill empty channel 2 slot with telemetry
+    return true;
+  }
+
+  /// Execute and remove first packet of deque
+  ///
+  /// \retval true  Command executed
+  /// \retval false Command not executed
+  bool executeFront() {
+    auto const& [packet, addr]{_deques.packet.front()};
     auto const retval{serviceMode() ? executeService()
                                     : executeOperations(addr, packet)};
     _deques.packet.pop_front();
@@ -345,7 +483,7 @@ private:
     countOwnEqualPackets();
 
     // Reset
-    if (auto const& packet{_deques.packet.front()}; !packet[0uz])
+    if (auto const& packet{_deques.packet.front().packet}; !packet[0uz])
       ;
     // Exit
     else if ((packet[0uz] & 0xF0u) != 0b0111'0000u) serviceMode(false);
@@ -381,6 +519,10 @@ private:
     // Count own equal packets (required for CV access)
     countOwnEqualPackets();
 
+    // Skip state which is about to be overwritten by a queued packet anyway
+    if constexpr (DCC_RX_COALESCE_PACKETS)
+      if (superseded()) return true;
+
     switch (decode_instruction(bytes)) {
       case Instruction::DecoderControl:
         if (!addr && !bytes[0uz]) {
@@ -465,22 +607,16 @@ private:
       // Speed, direction and function
       case 0b0011'1100u:
         if (size(bytes) < 3uz + sizeof(_checksum)) return false;
-        // F7-F0
-        if (size(bytes) > 3uz)
-          impl().function(
-            addr, 0xFFu << 0u, static_cast<uint32_t>(bytes[2uz]) << 0u);
-        // F15-F8
-        if (size(bytes) > 4uz)
-          impl().function(
-            addr, 0xFFu << 8u, static_cast<uint32_t>(bytes[3uz]) << 8u);
-        // F23-F16
-        if (size(bytes) > 5uz)
-          impl().function(
-            addr, 0xFFu << 16u, static_cast<uint32_t>(bytes[4uz]) << 16u);
-        // F31-F24
-        if (size(bytes) > 6uz)
-          impl().function(
-            addr, 0xFFu << 0u, static_cast<uint32_t>(bytes[5uz]) << 24u);
+        // F7-F0, F15-F8, F23-F16 and F31-F24 in a single call
+        else if (size(bytes) > 3uz) {
+          uint64_t mask{};
+          uint64_t state{};
+          for (auto i{0uz}; i < std::min(size(bytes) - 3uz, 4uz); ++i) {
+            mask |= 0xFFull << (i * CHAR_BIT);
+            state |= static_cast<uint64_t>(bytes[2uz + i]) << (i * CHAR_BIT);
+          }
+          deliverFunction(addr, mask, state);
+        }
         // Adjust length before fallthrough
         bytes = bytes.subspan<0uz, 2uz + sizeof(_checksum)>();
         [[fallthrough]];
@@ -537,7 +673,7 @@ private:
       if (addr) {
         constexpr auto mask{ztl::mask<0u>};
         auto const state{bytes[0uz] & ztl::mask<4u> ? ztl::mask<0u> : 0u};
-        impl().function(addr, mask, state);
+        deliverFunction(addr, mask, state);
       }
     }
     // 28 speed steps
@@ -587,7 +723,7 @@ private:
         break;
     }
 
-    impl().function(addr, mask, state);
+    deliverFunction(addr, mask, state);
 
     return true;
   }
@@ -641,7 +777,7 @@ private:
       // F20-F19-F18-F17-F16-F15-F14-F13
       case 0b1101'1110u:
         if (size(bytes) != 2uz + sizeof(_checksum)) return false;
-        impl().function(addr,
+        deliverFunction(addr,
                         ztl::mask<20u, 19u, 18u, 17u, 16u, 15u, 14u, 13u>,
                         static_cast<uint32_t>(bytes[1uz]) << 13u);
         break;
@@ -649,7 +785,7 @@ private:
       // F28-F27-F26-F25-F24-F23-F22-F21
       case 0b1101'1111u:
         if (size(bytes) != 2uz + sizeof(_checksum)) return false;
-        impl().function(addr,
+        deliverFunction(addr,
                         ztl::mask<28u, 27u, 26u, 25u, 24u, 23u, 22u, 21u>,
                         static_cast<uint32_t>(bytes[1uz]) << 21u);
         break;
@@ -657,26 +793,36 @@ private:
       // F36-F35-F34-F33-F32-F31-F30-F29
       case 0b1101'1000u:
         if (size(bytes) != 2uz + sizeof(_checksum)) return false;
+        deliverFunction(
+          addr, 0xFFull << 29u, static_cast<uint64_t>(bytes[1uz]) << 29u);
         break;
 
       // F44-F43-F42-F41-F40-F39-F38-F37
       case 0b1101'1001u:
         if (size(bytes) != 2uz + sizeof(_checksum)) return false;
+        deliverFunction(
+          addr, 0xFFull << 37u, static_cast<uint64_t>(bytes[1uz]) << 37u);
         break;
 
       // F52-F51-F50-F49-F48-F47-F46-F45
       case 0b1101'1010u:
         if (size(bytes) != 2uz + sizeof(_checksum)) return false;
+        deliverFunction(
+          addr, 0xFFull << 45u, static_cast<uint64_t>(bytes[1uz]) << 45u);
         break;
 
       // F60-F59-F58-F57-F56-F55-F54-F53
       case 0b1101'1011u:
         if (size(bytes) != 2uz + sizeof(_checksum)) return false;
+        deliverFunction(
+          addr, 0xFFull << 53u, static_cast<uint64_t>(bytes[1uz]) << 53u);
         break;
 
-      // F68-F67-F66-F65-F64-F63-F62-F61 (>F63 not supported)
+      // F68-F67-F66-F65-F64-F63-F62-F61
       case 0b1101'1100u:
         if (size(bytes) != 2uz + sizeof(_checksum)) return false;
+        deliverFunction(
+          addr, Functions{0xFFu} << 61uz, Functions{bytes[1uz]} << 61uz);
         break;
     }
 
@@ -714,9 +860,9 @@ private:
     // POM
     if (size(bytes) == 3uz + sizeof(_checksum)) {
       // Store packet for app:pom
-      if (_packets.pom != _deques.packet.front()) {
+      if (_packets.pom != _deques.packet.front().packet) {
         _deques.pom.clear();
-        _packets.pom = _deques.packet.front();
+        _packets.pom = _deques.packet.front().packet;
       }
 
       uint32_t const cv_addr{(bytes[0uz] & 0b11u) << 8u | bytes[1uz]};
@@ -871,7 +1017,7 @@ private:
   /// \param  cv_addr CV address
   /// \param  byte    CV value
   void cvVerifyImpl(uint32_t cv_addr, uint8_t byte) {
-    auto cb{[this, byte](uint8_t read_byte) {
+    CvCallback const cb{[this, byte](uint8_t read_byte) {
       if (!serviceMode()) pom(read_byte);
       else if (byte == read_byte) impl().serviceAck();
     }};
@@ -897,10 +1043,7 @@ private:
   void cvWrite(uint32_t cv_addr, std::unsigned_integral auto... ts) {
     if (_cvs_locked && cv_addr != 15u - 1u) return;
     cvWriteImpl(cv_addr, ts...);
-    if (std::ranges::contains(_init_cv_addrs, cv_addr)) {
-      if (cv_addr == 1u - 1u) impl().writeCv(29u - 1u, false, 5u);
-      init();
-    }
+    reconfigureIfRequired(cv_addr);
   }
 
   /// CV byte write
@@ -908,7 +1051,7 @@ private:
   /// \param  cv_addr CV address
   /// \param  byte    CV value
   void cvWriteImpl(uint32_t cv_addr, uint8_t byte) {
-    auto cb{[this, byte](uint8_t read_byte) {
+    CvCallback const cb{[this, byte](uint8_t read_byte) {
       if (!serviceMode()) pom(read_byte);
       else if (byte == read_byte) impl().serviceAck();
     }};
@@ -942,8 +1085,7 @@ private:
   /// \param  cv_addr CV address
   void xpomVerifyImpl(uint8_t ss, uint32_t cv_addr) {
     std::array<uint8_t, 4uz> cvs;
-    for (auto i{0uz}; i < size(cvs); ++i)
-      cvs[i] = impl().readCv(static_cast<uint32_t>(cv_addr + i));
+    bulkRead(cv_addr, cvs);
     xpom(ss, cvs);
   }
 
@@ -951,13 +1093,15 @@ private:
   ///
   /// \param  ss      Sequence number
   /// \param  cv_addr CV address
+  /// \param  ts...   CV values or bit and bit position
   void xpomWrite(uint8_t ss, uint32_t cv_addr, auto... ts) {
     if (_cvs_locked && cv_addr != 15u - 1u) return;
     xpomWriteImpl(ss, cv_addr, ts...);
-    if (std::ranges::contains(_init_cv_addrs, cv_addr)) {
-      if (cv_addr == 1u - 1u) impl().writeCv(29u - 1u, false, 5u);
-      init();
-    }
+    // Bytes write covers up to 4 CVs
+    if constexpr (sizeof...(ts) == 1uz)
+      for (auto i{0uz}; i < size(ts...); ++i)
+        reconfigureIfRequired(static_cast<uint32_t>(cv_addr + i));
+    else reconfigureIfRequired(cv_addr);
   }
 
   /// XPOM bytes write
@@ -968,10 +1112,16 @@ private:
   void
   xpomWriteImpl(uint8_t ss, uint32_t cv_addr, std::span<uint8_t const> bytes) {
     std::array<uint8_t, 4uz> cvs;
-    for (auto i{0uz}; i < size(cvs); ++i)
-      cvs[i] = i < size(bytes)
-                 ? impl().writeCv(static_cast<uint32_t>(cv_addr + i), bytes[i])
-                 : impl().readCv(static_cast<uint32_t>(cv_addr + i));
+    // Write all bytes at once and read them back together with the rest
+    if constexpr (BulkWritable<T>) {
+      impl().writeCvs(cv_addr, bytes);
+      bulkRead(cv_addr, cvs);
+    } else
+      for (auto i{0uz}; i < size(cvs); ++i)
+        cvs[i] =
+          i < size(bytes)
+            ? impl().writeCv(static_cast<uint32_t>(cv_addr + i), bytes[i])
+            : impl().readCv(static_cast<uint32_t>(cv_addr + i));
     xpom(ss, cvs);
   }
 
@@ -1046,20 +1196,541 @@ private:
       auto const reversed{addr == _addrs.primary ? _addrs.primary.reversed
                                                  : _addrs.primary.reversed ^
                                                      _addrs.consist.reversed};
-      impl().direction(addr, reversed ? !dir : dir);
+      deliverDirection(addr, reversed ? !dir : dir);
+    }
+    deliverSpeed(addr, speed);
+  }
+
+  /// Get cached callback state of address
+  ///
+  /// Packets to the logon address get executed as primary address, so there is
+  /// no separate state for it.
+  ///
+  /// \param  addr  Address
+  /// \return Pointer to cached state or nullptr if address isn't known
+  CallbackState* callbackState(Address::value_type addr) {
+    if (!addr) return nullptr;
+    else if (addr == _addrs.primary) return &_callback_states[0uz];
+    else if (addr == _addrs.consist) return &_callback_states[1uz];
+    else return nullptr;
+  }
+
+  /// Count callback and check whether it has to be delivered
+  ///
+  /// \param  changed Value changed
+  /// \retval true    Deliver callback
+  /// \retval false   Suppress callback
+  bool deliver(bool changed) {
+    if (changed || !_suppress_unchanged) {
+      ++_callback_counts.delivered;
+      return true;
+    } else {
+      ++_callback_counts.suppressed;
+      return false;
+    }
+  }
+
+  /// Call direction unless unchanged
+  ///
+  /// \param  addr  Address
+  /// \param  dir   Direction
+  void deliverDirection(Address::value_type addr, bool dir) {
+    auto const state{callbackState(addr)};
+    if (!deliver(!state || !state->known_dir || state->dir != dir)) return;
+    if (state) {
+      state->dir = dir;
+      state->known_dir = true;
+    }
+    impl().direction(addr, dir);
+  }
+
+  /// Call speed unless unchanged
+  ///
+  /// Broadcasts (e.g. emergency stop) invalidate the speed and direction of
+  /// all addresses.
+  ///
+  /// \param  addr  Address
+  /// \param  speed Speed
+  void deliverSpeed(Address::value_type addr, int32_t speed) {
+    auto const state{callbackState(addr)};
+    if (!addr)
+      for (auto& s : _callback_states) s.known_speed = s.known_dir = false;
+    if (!deliver(!state || !state->known_speed || state->speed != speed))
+      return;
+    if (state) {
+      state->speed = speed;
+      state->known_speed = true;
     }
     impl().speed(addr, speed);
   }
 
+  /// Call function(s) unless unchanged
+  ///
+  /// Decoders without aggregated functions only get F0-F31. Broadcasts
+  /// invalidate the functions of all addresses.
+  ///
+  /// \param  addr  Address
+  /// \param  mask  Mask of functions
+  /// \param  state State of functions
+  void deliverFunction(Address::value_type addr,
+                       Functions mask,
+                       Functions state) {
+    if constexpr (!AggregatedFunctions<T>) {
+      mask &= 0xFFFF'FFFFu;
+      if (mask.none()) return;
+    }
+    auto const cached{callbackState(addr)};
+    if (!addr)
+      for (auto& s : _callback_states) s.known_functions.reset();
+    if (!deliver(!cached || (mask & ~cached->known_functions).any() ||
+                 ((state ^ cached->functions) & mask).any()))
+      return;
+    if (cached) {
+      cached->functions = (cached->functions & ~mask) | (state & mask);
+      cached->known_functions |= mask;
+    }
+    if constexpr (AggregatedFunctions<T>) impl().functions(addr, mask, state);
+    else
+      impl().function(addr,
+                      static_cast<uint32_t>(mask.to_ullong()),
+                      static_cast<uint32_t>(
+                        (state & Functions{0xFFFF'FFFFu}).to_ullong()));
+  }
+
   /// Count own equal packets
   void countOwnEqualPackets() {
-    if (_packets.last == _deques.packet.front()) ++_counts.equal_packets;
+    if (_packets.last == _deques.packet.front().packet)
+      ++_counts.equal_packets;
     else {
       _counts.equal_packets = 1uz;
-      _packets.last = _deques.packet.front();
+      _packets.last = _deques.packet.front().packet;
     }
   }
 
+  /// Check whether first packet of deque is superseded by a later one
+  ///
+  /// Speed and function packets only carry state. If a packet of the same
+  /// class for the same address is already queued, executing the older one
+  /// would only cause stepping.
+  ///
+  /// \retval true  Packet superseded
+  /// \retval false Packet not superseded
+  bool superseded() const {
+    auto const& front{_deques.packet.front()};
+    auto const cls{stateClass(front)};
+    if (!cls) return false;
+    for (auto i{1uz}; i < size(_deques.packet); ++i)
+      if (auto const& pkt{_deques.packet[i]};
+          pkt.addr == front.addr && size(pkt.packet) == size(front.packet) &&
+          stateClass(pkt) == cls)
+        return true;
+    return false;
+  }
+
+  /// Get class of packets which only carry state
+  ///
+  /// \param  pkt Packet with decoded address
+  /// \return Masked instruction byte of speed or function packets, 0 otherwise
+  static constexpr uint8_t stateClass(AddressedPacket const& pkt) {
+    auto const& [packet, addr]{pkt};
+    if (addr.type != Address::Broadcast && addr.type != Address::BasicLoco &&
+        addr.type != Address::ExtendedLoco)
+      return 0u;
+    auto const byte{addr.type == Address::ExtendedLoco ? packet[2uz]
+                                                       : packet[1uz]};
+    // 128 speed steps
+    if (byte == 0b0011'1111u) return 0b0100'0000u;
+    // Speed and direction
+    else if ((byte & 0xC0u) == 0b0100'0000u) return 0b0100'0000u;
+    // F0-F4
+    else if ((byte & 0xE0u) == 0b1000'0000u) return 0b1000'0000u;
+    // F5-F8 and F9-F12
+    else if ((byte & 0xE0u) == 0b1010'0000u) return byte & 0xF0u;
+    // F13-F20, F21-F28 and F29-F68
+    else if (byte >= 0b1101'1000u && byte <= 0b1101'1111u &&
+             byte != 0b1101'1101u)
+      return byte;
+    else return 0u;
+  }
+
+  /// Switch-based encoding of commands bit by bit
+  ///
+  /// \param  time  Time in timer ticks
+  void receiveSwitch(uint32_t time) {
+    // Whatever we got, its not packet end anymore
+    _packet_end.store(false, std::memory_order_relaxed);
+
+    // Count consecutive one bits to determine if preamble is valid
+    auto const bit{time2bit<Period>(time)};
+    bool const valid_preamble{_counts.one_bit >=
+                              DCC_RX_MIN_PREAMBLE_BITS * 2uz};
+    _counts.one_bit = bit == _1 ? (_counts.one_bit + 1uz) : 0uz;
+
+    // Reset if bit invalid
+    if (bit == Invalid) return reset();
+
+    // Alternate halfbit <-> bit
+    if (_state > Startbit && (_is_halfbit = !_is_halfbit)) return;
+
+    // Successfully received a bit
+    switch (_state) {
+      case Preamble:
+        if (bit) return;
+        else if (valid_preamble) _state = Startbit;
+        else return reset();
+        break;
+
+      case Startbit:
+        _current = &_deques.packet.prepare();
+        _current->packet.clear();
+        _counts.bit = 0uz;
+        _is_halfbit = false;
+        increment(_counts.preamble);
+        _state = Data;
+        break;
+
+      case Data:
+        _byte = static_cast<uint8_t>((_byte << 1u) | bit);
+        if (++_counts.bit < CHAR_BIT) return;
+        _current->packet.push_back(_byte);
+        _checksum = static_cast<uint8_t>(_checksum ^ _byte);
+        _counts.bit = _byte = 0u;
+        _state = Endbit;
+        break;
+
+      case Endbit:
+        if (!bit) {
+          _state = Data;
+          return;
+        }
+        packetComplete();
+        break;
+
+      default: break;
+    }
+  }
+
+  /// Table-driven encoding of commands bit by bit
+  ///
+  /// Both halves of data- and endbits are states of their own. The first half
+  /// of a bit therefore costs a single table lookup without any further data
+  /// dependent branches.
+  ///
+  /// \param  time  Time in timer ticks
+  void receiveTable(uint32_t time) {
+    // Whatever we got, its not packet end anymore
+    _packet_end.store(false, std::memory_order_relaxed);
+
+    // Count consecutive one bits to determine if preamble is valid
+    auto const bit{time2bit<Period>(time)};
+    bool const valid_preamble{_counts.one_bit >=
+                              DCC_RX_MIN_PREAMBLE_BITS * 2uz};
+    _counts.one_bit = bit == _1 ? (_counts.one_bit + 1uz) : 0uz;
+
+    // Reset if bit invalid
+    if (bit == Invalid) return reset();
+
+    // First halves of data- and endbits end here
+    auto const [state, action]{transitions[_state][bit]};
+    _state = state;
+    if (action == Nothing) return;
+
+    switch (action) {
+      case CheckPreamble:
+        if (!valid_preamble) reset();
+        break;
+
+      case Begin:
+        _current = &_deques.packet.prepare();
+        _current->packet.clear();
+        _counts.bit = 0uz;
+        increment(_counts.preamble);
+        break;
+
+      case Shift:
+        _byte = static_cast<uint8_t>((_byte << 1u) | bit);
+        if (++_counts.bit < CHAR_BIT) break;
+        _current->packet.push_back(_byte);
+        _checksum = static_cast<uint8_t>(_checksum ^ _byte);
+        _counts.bit = _byte = 0u;
+        _state = Endbit;
+        break;
+
+      case Complete: packetComplete(); break;
+
+      default: break;
+    }
+  }
+
+  /// Execute or commit valid packet after endbit
+  ///
+  /// Packets are assembled in-place in the queue, so committing only has to
+  /// publish the slot.
+  void packetComplete() {
+    auto& [packet, addr]{*_current};
+    if (!_checksum && size(packet) >= 3uz) {
+      _packet_end.store(true, std::memory_order_relaxed);
+      increment(_counts.packet);
+      addr = _addrs.received = decode_address(packet);
+      _instr = decode_instruction(packet);
+      if (executeHandlerMode())
+        ;
+      else if (!filter()) increment(_counts.filtered);
+      else _deques.packet.commit();
+    }
+    // Immediately clear received address and invalid packet
+    else {
+      _addrs.received = {};
+      packet.clear();
+    }
+    reset();
+  }
+
+  /// Check whether current packet might concern this decoder
+  ///
+  /// Raw address bytes are compared against the precomputed ones of primary,
+  /// consist and logon address. Service mode packets directly following a
+  /// reset pass as well, since thread mode might not have entered service mode
+  /// yet. Everything passes while logon changed addresses and thread mode
+  /// hasn't updated the filter yet.
+  ///
+  /// \retval true  Packet might concern this decoder
+  /// \retval false Packet doesn't concern this decoder
+  bool filter() {
+    auto const& addrs{
+      _filters[_filter_index.load(std::memory_order_acquire)]};
+    auto const& packet{_current->packet};
+    auto const first{packet[0uz]};
+    auto const service{std::exchange(
+      _maybe_service, (!first && !packet[1uz]) ||
+                        (_maybe_service && (first & 0xF0u) == 0b0111'0000u))};
+    // Service mode or outdated filter
+    if (serviceMode() || service ||
+        _filter_outdated.load(std::memory_order_relaxed))
+      return true;
+    // Broadcast or automatic logon
+    else if (!first || first == 254u) return true;
+    // Basic loco
+    else if (first <= 127u) return std::ranges::contains(addrs, first);
+    // Extended loco
+    else if (first >= 192u && first <= 231u)
+      return std::ranges::contains(
+        addrs, static_cast<uint16_t>(first << 8u | packet[1uz]));
+    // Everything else
+    else return false;
+  }
+
+  /// Precompute raw address bytes of primary, consist and logon address
+  ///
+  /// The addresses are written to the currently unpublished buffer, which is
+  /// then published by a single store of its index. Must only be called in
+  /// thread mode, handler mode sets _filter_outdated instead.
+  void updateFilter() {
+    auto const i{_filter_index.load(std::memory_order_relaxed) ^ 1uz};
+    std::ranges::transform(
+      std::array{_addrs.primary, _addrs.consist, _addrs.logon},
+      begin(_filters[i]),
+      [](Address addr) -> uint16_t {
+        switch (addr.type) {
+          case Address::BasicLoco: return addr.value;
+          case Address::ExtendedLoco:
+            return static_cast<uint16_t>(0xC000u | addr.value);
+          default: return 0xFFFFu;
+        }
+      });
+    _filter_index.store(i, std::memory_order_release);
+  }
+
+  /// Update filter if handler mode marked it outdated
+  void syncFilter() {
+    if (_filter_outdated.exchange(false, std::memory_order_acquire))
+      updateFilter();
+  }
+
+  /// Derive primary address
+  ///
+  /// \param  cv29  Configuration
+  void derivePrimaryAddress(uint8_t cv29) {
+    if (cv29 & ztl::mask<5u>) {
+      std::array const cv17_cv18{impl().readCv(17u - 1u),
+                                 impl().readCv(18u - 1u)};
+      _addrs.primary = decode_address(cv17_cv18);
+    } else {
+      auto const cv1{impl().readCv(1u - 1u)};
+      _addrs.primary = decode_address(&cv1);
+    }
+    _addrs.primary.reversed = cv29 & ztl::mask<0u>;
+    deriveShortInfo();
+  }
+
+  /// Derive app:decoder_unique datagram
+  void deriveDecoderUnique() {
+    _logon_dgs.decoder_unique =
+      bidi::make_app_decoder_unique_datagram(DCC_MANUFACTURER_ID, _ids.decoder);
+  }
+
+  /// Seed random number generators of backoffs from decoder ID
+  ///
+  /// Decoders with different IDs then back off differently without having to
+  /// seed anything. Generators without seed are left alone.
+  void seedBackoffs() {
+    if constexpr (requires(G g, uint32_t seed) { g.seed(seed); }) {
+      auto const did{data2uint32(cbegin(_ids.decoder))};
+      _backoffs.logon.generator().seed(did);
+      _backoffs.search.generator().seed(~did);
+    }
+  }
+
+  /// Derive ShortInfo datagram
+  void deriveShortInfo() {
+    std::array<uint8_t, 5uz> short_info{
+      ztl::mask<7u>, // Special format & address
+      0u,            // Address
+      63u,           // Highest function
+      ztl::mask<6u>, // XPOM
+      0u};
+    encode_logon_address(_addrs.primary, begin(short_info) + 1);
+    _logon_dgs.short_info =
+      bidi::encode_datagram(bidi::make_datagram<bidi::Bits::_48>(
+        static_cast<uint64_t>(short_info[0uz]) << 40u |
+        static_cast<uint64_t>(short_info[1uz]) << 32u |
+        static_cast<uint32_t>(short_info[2uz]) << 24u |
+        static_cast<uint32_t>(short_info[3uz]) << 16u |
+        static_cast<uint32_t>(short_info[4uz]) << 8u | crc8(short_info)));
+  }
+
+  /// Derive consist address
+  ///
+  /// \param  cv19  Consist address
+  /// \param  cv20  Extended consist address
+  void deriveConsistAddress(uint8_t cv19, uint8_t cv20) {
+    auto const consist_addr{100u * (cv20 & 0b0111'1111u) +
+                            (cv19 & 0b0111'1111u)};
+    _addrs.consist = {static_cast<Address::value_type>(consist_addr),
+                      consist_addr <= 127u ? Address::BasicLoco
+                                           : Address::ExtendedLoco};
+    _addrs.consist.reversed = cv19 & ztl::mask<7u>;
+  }
+
+  /// Derive legacy exception for F0
+  ///
+  /// \param  cv29  Configuration
+  void deriveF0Exception(uint8_t cv29) {
+    _f0_exception = !(cv29 & ztl::mask<1u>);
+  }
+
+  /// Derive decoder lock
+  ///
+  /// \param  cv15  Decoder lock
+  /// \param  cv16  Decoder lock compare
+  void deriveDecoderLock(uint8_t cv15, uint8_t cv16) {
+    _cvs_locked = cv15 != cv16 && cv15 && cv16;
+  }
+
+  /// Derive BiDi channels
+  ///
+  /// \param  cv20  Extended consist address
+  /// \param  cv28  BiDi configuration
+  /// \param  cv29  Configuration
+  void deriveBiDi(uint8_t cv20, uint8_t cv28, uint8_t cv29) {
+    auto const bidi_enabled{static_cast<bool>(cv29 & ztl::mask<3u>)};
+    auto const ch2_consist_enabled{static_cast<bool>(cv20 & ztl::mask<7u>)};
+    _ch1_addr_enabled = bidi_enabled && (cv28 & ztl::mask<0u>);
+    _ch2_data_enabled = bidi_enabled && (cv28 & ztl::mask<1u>);
+    _logon_enabled = bidi_enabled && (cv28 & ztl::mask<7u>);
+    _ch2_consist_enabled = bidi_enabled && ch2_consist_enabled;
+  }
+
+  /// Derive again whatever depends on a written CV, if there is anything
+  ///
+  /// \param  cv_addr CV address
+  void reconfigureIfRequired(uint32_t cv_addr) {
+    if (!std::ranges::contains(_init_cv_addrs, cv_addr)) return;
+    if (cv_addr == 1u - 1u) impl().writeCv(29u - 1u, false, 5u);
+    reconfigure(cv_addr);
+  }
+
+  /// Derive again whatever depends on a written CV
+  ///
+  /// Unlike init() this only reads the CVs the derived state depends on.
+  ///
+  /// \param  cv_addr CV address
+  void reconfigure(uint32_t cv_addr) {
+    switch (cv_addr + 1u) {
+      case 1u: [[fallthrough]];
+      case 17u: [[fallthrough]];
+      case 18u: derivePrimaryAddress(impl().readCv(29u - 1u)); break;
+
+      // Decoder lock doesn't invalidate anything
+      case 15u: [[fallthrough]];
+      case 16u: {
+        auto const cv15{impl().readCv(15u - 1u)};
+        auto const cv16{impl().readCv(16u - 1u)};
+        deriveDecoderLock(cv15, cv16);
+        return;
+      }
+
+      case 19u: [[fallthrough]];
+      case 20u: {
+        auto const cv19{impl().readCv(19u - 1u)};
+        auto const cv20{impl().readCv(20u - 1u)};
+        deriveConsistAddress(cv19, cv20);
+        if (cv_addr == 20u - 1u) {
+          auto const cv28{impl().readCv(28u - 1u)};
+          auto const cv29{impl().readCv(29u - 1u)};
+          deriveBiDi(cv20, cv28, cv29);
+        }
+        break;
+      }
+
+      case 28u: {
+        auto const cv20{impl().readCv(20u - 1u)};
+        auto const cv28{impl().readCv(28u - 1u)};
+        auto const cv29{impl().readCv(29u - 1u)};
+        deriveBiDi(cv20, cv28, cv29);
+        break;
+      }
+
+      case 29u: {
+        auto const cv29{impl().readCv(29u - 1u)};
+        derivePrimaryAddress(cv29);
+        deriveF0Exception(cv29);
+        auto const cv20{impl().readCv(20u - 1u)};
+        auto const cv28{impl().readCv(28u - 1u)};
+        deriveBiDi(cv20, cv28, cv29);
+        break;
+      }
+
+      default: return;
+    }
+    updateFilter();
+    invalidate();
+  }
+
+  /// Invalidate whatever depends on the old addresses or configuration
+  void invalidate() {
+    // Addresses or direction might have changed
+    _callback_states = {};
+
+    // Initialization time point
+    _tps.init = timePoint();
+
+    // Clear deques
+    _deques.dyn.clear();
+    _deques.logon.clear();
+    _deques.search.clear();
+    _deques.adr.clear();
+    _deques.pom.clear();
+  }
+
+  /// Increment count only ever written in handler mode
+  ///
+  /// \param  count  Count
+  static void increment(std::atomic<size_t>& count) {
+    count.store(count.load(std::memory_order_relaxed) + 1uz,
+                std::memory_order_relaxed);
+  }
+
   /// Reset
   void reset() {
     _counts.bit = _byte = _checksum = 0u;
@@ -1073,10 +1744,10 @@ private:
     // Disable other peripherals which might interfere
     if (enter) {
       impl().serviceModeHook(true);
-      _mode = Service;
+      _mode.store(Service, std::memory_order_relaxed);
     } else {
       impl().serviceModeHook(false);
-      _mode = Operations;
+      _mode.store(Operations, std::memory_order_relaxed);
     }
   }
 
@@ -1102,36 +1773,30 @@ private:
   void trackSearch() {
     using std::literals::chrono_literals::operator""s;
     if (_backoffs.search || !empty(_deques.search)) return;
-    auto const now{std::chrono::system_clock::now()};
+    auto const now{timePoint()};
     if (std::chrono::duration_cast<std::chrono::seconds>(now - _tps.init) >=
         30s)
       return;
-    if (_tps.search == decltype(_tps.search){}) _tps.search = now;
+    if (!_tps.search) _tps.search = now;
+    auto const secs{
+      static_cast<uint8_t>(std::chrono::duration_cast<std::chrono::seconds>(
+                             *_tps.search - _tps.init)
+                             .count())};
     // Active address is logon
     if (_logon_assigned)
-      _deques.search.push_back(bidi::make_app_search_datagram(
-        _addrs.logon,
-        0u,
-        static_cast<uint8_t>(std::chrono::duration_cast<std::chrono::seconds>(
-                               _tps.search - _tps.init)
-                               .count())));
+      _deques.search.push_back(
+        bidi::make_app_search_datagram(_addrs.logon, 0u, secs));
     // Active address is primary
     else if (!_addrs.consist)
-      _deques.search.push_back(bidi::make_app_search_datagram(
-        _addrs.primary,
-        0u,
-        static_cast<uint8_t>(std::chrono::duration_cast<std::chrono::seconds>(
-                               _tps.search - _tps.init)
-                               .count())));
+      _deques.search.push_back(
+        bidi::make_app_search_datagram(_addrs.primary, 0u, secs));
     // Active address is consist
     else
       _deques.search.push_back(bidi::make_app_search_datagram(
         _addrs.consist,
         static_cast<uint8_t>((_addrs.consist.reversed ? 0x80u : 0u) |
                              (_addrs.consist & 0x7Fu)),
-        static_cast<uint8_t>(std::chrono::duration_cast<std::chrono::seconds>(
-                               _tps.search - _tps.init)
-                               .count())));
+        secs));
   }
 
   /// Logon enable
@@ -1168,6 +1833,7 @@ private:
     else {
       _logon_assigned = false;
       _addrs.logon = {};
+      _filter_outdated.store(true, std::memory_order_release);
     }
 
     switch ([[maybe_unused]] auto const gg{
@@ -1180,8 +1846,7 @@ private:
 
     if (_backoffs.logon) return true;
     _deques.logon.clear();
-    _deques.logon.push_back(bidi::make_app_decoder_unique_datagram(
-      DCC_MANUFACTURER_ID, _ids.decoder));
+    _deques.logon.push_back(_logon_dgs.decoder_unique);
 
     // Return false after 3 app:decoder_unique datagrams. This keeps the packet
     // in the deque to be picked up and executed in thread mode.
@@ -1200,46 +1865,92 @@ private:
 
     switch (bytes[6uz]) {
       // ShortInfo
-      case 0b1111'1111u: break;
+      case 0b1111'1111u:
+        _logon_selected = true;
+        _deques.logon.clear();
+        _deques.logon.push_back(_logon_dgs.short_info);
+        return true;
       // Read block
-      case 0b1111'1110u: [[fallthrough]];
+      case 0b1111'1110u:
+        if constexpr (BlockReadable<T>) return logonReadBlock(bytes);
+        else break;
       // Write block
-      case 0b1111'1100u: [[fallthrough]];
+      case 0b1111'1100u:
+        if constexpr (BlockWritable<T>) return logonWriteBlock(bytes);
+        else break;
       // Set decoder internal status
-      case 0b1111'1011u: [[fallthrough]];
+      case 0b1111'1011u: break;
       // Reserved
-      default:
-        _deques.logon.clear();
-        _deques.logon.push_back({bidi::nak,
-                                 bidi::nak,
-                                 bidi::nak,
-                                 bidi::nak,
-                                 bidi::nak,
-                                 bidi::nak,
-                                 bidi::nak,
-                                 bidi::nak});
+      default: break;
+    }
+
+    _deques.logon.clear();
+    _deques.logon.push_back(logon_nak);
+    return true;
+  }
+
+  /// Logon read block
+  ///
+  /// Blocks are addressed in chunks of 4 bytes by a 16 bit index following the
+  /// subcommand. The response contains the low byte of the index, the chunk
+  /// and a CRC8. Runs in handler mode, see BlockReadable.
+  ///
+  /// \param  bytes Raw bytes
+  /// \retval true  Command executed
+  /// \retval false Command not executed
+  bool logonReadBlock(std::span<uint8_t const> bytes) {
+    _deques.logon.clear();
+    // Command, index, CRC8 and checksum
+    if (size(bytes) == 7uz + 2uz + 1uz + sizeof(_checksum)) {
+      auto const index{data2uint16(&bytes[7uz])};
+      std::array<uint8_t, 1uz + 4uz> chunk{static_cast<uint8_t>(index)};
+      if (impl().readBlock(index, std::span{chunk}.subspan<1uz>())) {
+        _deques.logon.push_back(logonBlockDatagram(chunk));
         return true;
+      }
     }
+    _deques.logon.push_back(logon_nak);
+    return true;
+  }
 
-    _logon_selected = true;
-    std::array<uint8_t, 5uz> short_info{
-      ztl::mask<7u>, // Special format & address
-      0u,            // Address
-      63u,           // Highest function
-      ztl::mask<6u>, // XPOM
-      0u};
-    encode_logon_address(_addrs.primary, begin(short_info) + 1);
+  /// Logon write block
+  ///
+  /// The chunk follows the 16 bit index. On success the response echoes the
+  /// low byte of the index and the chunk, followed by a CRC8. Runs in handler
+  /// mode, see BlockWritable.
+  ///
+  /// \param  bytes Raw bytes
+  /// \retval true  Command executed
+  /// \retval false Command not executed
+  bool logonWriteBlock(std::span<uint8_t const> bytes) {
     _deques.logon.clear();
-    _deques.logon.push_back(
-      bidi::encode_datagram(bidi::make_datagram<bidi::Bits::_48>(
-        static_cast<uint64_t>(short_info[0uz]) << 40u |
-        static_cast<uint64_t>(short_info[1uz]) << 32u |
-        static_cast<uint32_t>(short_info[2uz]) << 24u |
-        static_cast<uint32_t>(short_info[3uz]) << 16u |
-        static_cast<uint32_t>(short_info[4uz]) << 8u | crc8(short_info))));
+    // Command, index, chunk, CRC8 and checksum
+    if (size(bytes) == 7uz + 2uz + 4uz + 1uz + sizeof(_checksum)) {
+      auto const index{data2uint16(&bytes[7uz])};
+      auto const block{bytes.subspan<9uz, 4uz>()};
+      if (impl().writeBlock(index, block)) {
+        std::array<uint8_t, 1uz + 4uz> chunk{static_cast<uint8_t>(index)};
+        std::ranges::copy(block, begin(chunk) + 1);
+        _deques.logon.push_back(logonBlockDatagram(chunk));
+        return true;
+      }
+    }
+    _deques.logon.push_back(logon_nak);
     return true;
   }
 
+  /// Make block response datagram
+  ///
+  /// \param  chunk Low byte of index and chunk
+  /// \return Encoded datagram
+  static constexpr bidi::Datagram<>
+  logonBlockDatagram(std::array<uint8_t, 1uz + 4uz> const& chunk) {
+    uint64_t data{};
+    for (auto const byte : chunk) data = data << 8u | byte;
+    return bidi::encode_datagram(
+      bidi::make_datagram<bidi::Bits::_48>(data << 8u | crc8(chunk)));
+  }
+
   /// Logon assign
   ///
   /// \param  bytes Raw bytes
@@ -1255,14 +1966,7 @@ private:
     // Don't accept assign
     if (addr.type != Address::BasicLoco && addr.type != Address::ExtendedLoco) {
       _deques.logon.clear();
-      _deques.logon.push_back({bidi::nak,
-                               bidi::nak,
-                               bidi::nak,
-                               bidi::nak,
-                               bidi::nak,
-                               bidi::nak,
-                               bidi::nak,
-                               bidi::nak});
+      _deques.logon.push_back(logon_nak);
       return true;
     }
 
@@ -1274,19 +1978,9 @@ private:
     if (auto const bb{static_cast<LogonBindingBehavior>(bytes[6uz] >> 6u)};
         bb == LogonBindingBehavior::Permanent && addr)
       _addrs.primary = addr;
+    _filter_outdated.store(true, std::memory_order_release);
     _deques.logon.clear();
-    _deques.logon.push_back(bidi::make_app_decoder_state_datagram(
-      0xFFu,           // Change flags
-      0u,              // Change count
-      ztl::mask<7u,    // app:dyn ID7:27
-                6u,    // app:dyn ID7:26
-                4u,    // app:dyn ID7:7
-                3u>,   // app:dyn ID7:0-1
-      ztl::mask<6u,    // Special operating modes
-                4u,    // CV access short
-                3u,    // SDF
-                2u,    // Binary state control long
-                1u>)); // Binary state control short
+    _deques.logon.push_back(logon_decoder_state);
     return true;
   }
 
@@ -1321,18 +2015,46 @@ private:
 
   /// Add app:dyn datagrams
   ///
+  /// Datagrams get packed into channel 2 frames right away, so that the cutout
+  /// only has to transmit the first frame.
+  ///
   /// \param  d DV (dynamic CV)
   /// \param  x Subindex
   void dyn(uint8_t d, uint8_t x) {
-    if (!_ch2_data_enabled || full(_deques.dyn)) return;
-    _deques.dyn.push_back(bidi::make_app_dyn_datagram(d, x));
+    if (!_ch2_data_enabled || dynCount() == DCC_RX_BIDI_DEQUE_SIZE) return;
+    auto const dg{bidi::make_app_dyn_datagram(d, x)};
+    if (empty(_deques.dyn) ||
+        size(_deques.dyn.back()) + size(dg) > bidi::channel2_size)
+      _deques.dyn.push_back({});
+    std::ranges::copy(dg, std::back_inserter(_deques.dyn.back()));
+  }
+
+  /// Pull due telemetry sources into empty dyn deque
+  ///
+  /// Pulling only one frame at a time keeps values as fresh as possible.
+  void pullTelemetry() {
+    if (!_ch2_data_enabled || !empty(_deques.dyn)) return;
+    std::array<bidi::app::Dyn, dyns_per_frame> dyns;
+    auto const count{_telemetry.pull(_tps.packet, dyns)};
+    for (auto const [d, x] : std::span{dyns}.first(count)) dyn(d, x);
+  }
+
+  /// Number of app:dyn datagrams
+  ///
+  /// All frames but the last one are full.
+  ///
+  /// \return Number of app:dyn datagrams
+  size_t dynCount() const {
+    if (empty(_deques.dyn)) return 0uz;
+    return (size(_deques.dyn) - 1uz) * dyns_per_frame +
+           size(_deques.dyn.back()) / dyn_size;
   }
 
   /// Handle app:adr_low and app:adr_high datagrams
   void appAdr() {
     if (empty(_deques.adr)) return;
-    _ch1 = _deques.adr.front();
-    impl().transmitBiDi({cbegin(_ch1), size(_ch1)});
+    auto const& dg{_deques.adr.front()};
+    impl().transmitBiDi({cbegin(dg), size(dg)});
     _deques.adr.pop_front();
   }
 
@@ -1340,10 +2062,9 @@ private:
   void appPom() {
     // Deque contains data for this packet
     if (!empty(_deques.pom) &&
-        (_packets.current == _packets.pom || _instr != Instruction::CvAccess)) {
+        (_current->packet == _packets.pom || _instr != Instruction::CvAccess)) {
       auto const& dg{_deques.pom.front()};
-      std::copy(cbegin(dg), cend(dg), begin(_ch2));
-      impl().transmitBiDi({cbegin(_ch2), size(dg)});
+      impl().transmitBiDi({cbegin(dg), size(dg)});
       _deques.pom.pop_front();
     }
     // Implicitly acknowledge all CV access commands
@@ -1354,22 +2075,16 @@ private:
   /// Handle app:dyn
   void appDyn() {
     if (empty(_deques.dyn)) return;
-    auto first{begin(_ch2)};
-    auto const last{cend(_ch2)};
-    do {
-      auto const& dg{_deques.dyn.front()};
-      first = std::copy_n(cbegin(dg), size(dg), first);
-      _deques.dyn.pop_front();
-    } while (!empty(_deques.dyn) && last - first >= ssize(_deques.dyn.front()));
-    impl().transmitBiDi({cbegin(_ch2), first});
+    auto const& frame{_deques.dyn.front()};
+    impl().transmitBiDi({cbegin(frame), size(frame)});
+    _deques.dyn.pop_front();
   }
 
   /// Handle app:xpom
   void appXpom() {
     if (!empty(_deques.xpom)) {
       auto const& dg{_deques.xpom.front()};
-      std::copy(cbegin(dg), cend(dg), begin(_ch2));
-      impl().transmitBiDi({cbegin(_ch2), size(dg)});
+      impl().transmitBiDi({cbegin(dg), size(dg)});
       _deques.xpom.pop_front();
     }
     // Implicitly acknowledge all CV access commands
@@ -1381,20 +2096,18 @@ private:
   void appSearch() {
     if (empty(_deques.search)) return;
     auto const& dg{_deques.search.front()};
-    std::ranges::copy(dg, begin(_ch2));
-    impl().transmitBiDi({cbegin(_ch2), size(dg)});
+    impl().transmitBiDi({cbegin(dg), size(dg)});
     _deques.search.pop_front();
   }
 
   /// Handle app:logon
   void appLogon(uint32_t ch) {
     if (empty(_deques.logon)) return;
-    if (auto const& dg{_deques.logon.front()}; ch == 1u) {
-      std::copy(begin(dg), begin(dg) + 2, begin(_ch1));
-      impl().transmitBiDi({cbegin(_ch1), size(_ch1)});
-    } else {
-      std::copy(begin(dg) + 2, end(dg), begin(_ch2));
-      impl().transmitBiDi({cbegin(_ch2), size(_ch2)});
+    if (auto const& dg{_deques.logon.front()}; ch == 1u)
+      impl().transmitBiDi({cbegin(dg), bidi::channel1_size});
+    else {
+      impl().transmitBiDi(
+        {cbegin(dg) + bidi::channel1_size, bidi::channel2_size});
       _deques.logon.pop_front();
     }
   }
@@ -1414,39 +2127,87 @@ private:
 
     // Logon assign is permanent
     if (_addrs.primary == _addrs.logon) {
+      deriveShortInfo();
       if (_addrs.logon.type == Address::BasicLoco) {
         impl().writeCv(1u - 1u, logon_addr_cvs[0uz]);
         impl().writeCv(29u - 1u, false, 5u);
       } else {
-        impl().writeCv(17u - 1u, logon_addr_cvs[0uz]);
-        impl().writeCv(18u - 1u, logon_addr_cvs[1uz]);
+        bulkWrite(17u - 1u, logon_addr_cvs);
         impl().writeCv(29u - 1u, true, 5u);
       }
     }
 
     // Every assign clears eventually set consist address
-    impl().writeCv(19u - 1u, 0u);
-    impl().writeCv(20u - 1u, 0u);
+    bulkWrite(19u - 1u, std::array<uint8_t, 2uz>{});
 
     _ids.cs.front() = _ids.cs.back();
-    impl().writeCv(DCC_RX_LOGON_CID_CV_ADDRESS + 0u,
-                   static_cast<uint8_t>(_ids.cs.back() >> 8u));
-    impl().writeCv(DCC_RX_LOGON_CID_CV_ADDRESS + 1u,
-                   static_cast<uint8_t>(_ids.cs.back()));
-
     _ids.session.front() = _ids.session.back();
-    impl().writeCv(DCC_RX_LOGON_SID_CV_ADDRESS, _ids.session.back());
-    impl().writeCv(DCC_RX_LOGON_ADDRESS_CV_ADDRESS + 0u, logon_addr_cvs[0uz]);
-    impl().writeCv(DCC_RX_LOGON_ADDRESS_CV_ADDRESS + 1u, logon_addr_cvs[1uz]);
+    std::array const cid_cvs{static_cast<uint8_t>(_ids.cs.back() >> 8u),
+                             static_cast<uint8_t>(_ids.cs.back())};
+
+    // CID, SID and logon address in one go if they are consecutive (default)
+    if constexpr (DCC_RX_LOGON_CID_CV_ADDRESS + 2u ==
+                    DCC_RX_LOGON_SID_CV_ADDRESS &&
+                  DCC_RX_LOGON_SID_CV_ADDRESS + 1u ==
+                    DCC_RX_LOGON_ADDRESS_CV_ADDRESS)
+      bulkWrite(DCC_RX_LOGON_CID_CV_ADDRESS,
+                std::array{cid_cvs[0uz],
+                           cid_cvs[1uz],
+                           _ids.session.back(),
+                           logon_addr_cvs[0uz],
+                           logon_addr_cvs[1uz]});
+    else {
+      bulkWrite(DCC_RX_LOGON_CID_CV_ADDRESS, cid_cvs);
+      impl().writeCv(DCC_RX_LOGON_SID_CV_ADDRESS, _ids.session.back());
+      bulkWrite(DCC_RX_LOGON_ADDRESS_CV_ADDRESS, logon_addr_cvs);
+    }
+  }
+
+  /// Read consecutive CVs, in one go if supported
+  ///
+  /// \param  cv_addr CV address of first byte
+  /// \param  bytes   CV values
+  void bulkRead(uint32_t cv_addr, std::span<uint8_t> bytes) {
+    if constexpr (BulkReadable<T>) impl().readCvs(cv_addr, bytes);
+    else
+      for (auto i{0uz}; i < size(bytes); ++i)
+        bytes[i] = impl().readCv(static_cast<uint32_t>(cv_addr + i));
+  }
+
+  /// Write consecutive CVs, in one go if supported
+  ///
+  /// \param  cv_addr CV address of first byte
+  /// \param  bytes   CV values
+  void bulkWrite(uint32_t cv_addr, std::span<uint8_t const> bytes) {
+    if constexpr (BulkWritable<T>) impl().writeCvs(cv_addr, bytes);
+    else
+      for (auto i{0uz}; i < size(bytes); ++i)
+        impl().writeCv(static_cast<uint32_t>(cv_addr + i), bytes[i]);
   }
 
   /// Update quality of service every 200 packets (roughly every 2 seconds)
   void updateQos() {
-    if (_counts.preamble < 200uz) return;
+    // Packets are counted after their preamble, so load them first
+    auto const packet{_counts.packet.load(std::memory_order_relaxed)};
+    auto const preamble{_counts.preamble.load(std::memory_order_relaxed)};
+    auto const preambles{preamble - _seen.preamble};
+    if (preambles < 200uz) return;
     _qos = static_cast<uint8_t>(
-      100uz - (std::min(_counts.packet + 1uz, _counts.preamble) * 100uz) /
-                _counts.preamble);
-    _counts.packet = _counts.preamble = 0uz;
+      100uz -
+      (std::min(packet - _seen.packet + 1uz, preambles) * 100uz) / preambles);
+    _seen.packet = packet;
+    _seen.preamble = preamble;
+  }
+
+  /// Get current time point
+  ///
+  /// Decoders can provide their own monotonic millisecond tick count.
+  ///
+  /// \return Current time point
+  Clock::time_point timePoint() {
+    if constexpr (Clocked<T>)
+      return Clock::time_point{Clock::duration{impl().now()}};
+    else return Clock::now();
   }
 
   /// Update time points
@@ -1454,16 +2215,41 @@ private:
   /// In case time between two packets is >=1s allow tip-off search again.
   void updateTimePoints() {
     using std::literals::chrono_literals::operator""s;
-    auto const now{std::chrono::system_clock::now()};
+    auto const now{timePoint()};
     if (now - _tps.packet >= 1s) {
       _backoffs.search.now();
-      _tps.search = decltype(_tps.search){};
+      _tps.search.reset();
       _tps.init = now;
     }
     _tps.packet = now;
   }
 
-  // CVs where modification requires call of `init()`
+  /// NAK response to logon commands
+  static constexpr bidi::Datagram<> logon_nak{bidi::nak,
+                                              bidi::nak,
+                                              bidi::nak,
+                                              bidi::nak,
+                                              bidi::nak,
+                                              bidi::nak,
+                                              bidi::nak,
+                                              bidi::nak};
+
+  /// app:decoder_state response to logon assign
+  static constexpr auto logon_decoder_state{
+    bidi::make_app_decoder_state_datagram(
+      0xFFu,           // Change flags
+      0u,              // Change count
+      ztl::mask<7u,    // app:dyn ID7:27
+                6u,    // app:dyn ID7:26
+                4u,    // app:dyn ID7:7
+                3u>,   // app:dyn ID7:0-1
+      ztl::mask<6u,    // Special operating modes
+                4u,    // CV access short
+                3u,    // SDF
+                2u,    // Binary state control long
+                1u>)}; // Binary state control short
+
+  // CVs where modification requires call of `reconfigure()`
   static constexpr std::array<uint8_t, 9uz> _init_cv_addrs{1u - 1u,
                                                            15u - 1u,
                                                            16u - 1u,
@@ -1476,26 +2262,42 @@ private:
 
   // Counts
   struct {
-    size_t one_bit{};        ///< Consecutive ones
-    size_t bit{};            ///< Current bits
-    size_t packet{};         ///< Successfully received packets
-    size_t preamble{};       ///< Successfully received preambles
-    size_t equal_packets{};  ///< Equal packets
-    size_t decoder_unique{}; ///< app:decoder_unique transmissions
+    size_t one_bit{};               ///< Consecutive ones
+    size_t bit{};                   ///< Current bits
+    std::atomic<size_t> packet{};   ///< Successfully received packets
+    std::atomic<size_t> preamble{}; ///< Successfully received preambles
+    std::atomic<size_t> filtered{}; ///< Filtered packets
+    size_t equal_packets{};         ///< Equal packets
+    size_t decoder_unique{};        ///< app:decoder_unique transmissions
   } _counts{};
 
+  // Counts last seen in thread mode
+  struct {
+    size_t packet{};   ///< Successfully received packets
+    size_t preamble{}; ///< Successfully received preambles
+    size_t filtered{}; ///< Filtered packets
+  } _seen{};
+
   // Time points
   struct {
-    std::chrono::time_point<std::chrono::system_clock> init{};
-    std::chrono::time_point<std::chrono::system_clock> packet{};
-    std::chrono::time_point<std::chrono::system_clock> search{};
+    Clock::time_point init{};
+    Clock::time_point packet{};
+    std::optional<Clock::time_point> search{};
   } _tps{};
 
+  // app:dyn datagrams packed into channel 2 frames
+  static constexpr auto dyn_size{bidi::datagram_size<bidi::Bits::_18>};
+  static constexpr auto dyns_per_frame{bidi::channel2_size / dyn_size};
+
   // Deques
+  //
+  // Datagrams are transmitted straight from the deques, so that the cutout
+  // doesn't have to copy or assemble anything.
   struct {
-    ztl::inplace_deque<Packet, DCC_RX_DEQUE_SIZE> packet{};
-    ztl::inplace_deque<bidi::Datagram<bidi::datagram_size<bidi::Bits::_18>>,
-                       DCC_RX_BIDI_DEQUE_SIZE>
+    SpscQueue<AddressedPacket, DCC_RX_DEQUE_SIZE> packet{};
+    ztl::inplace_deque<ztl::inplace_vector<uint8_t, bidi::channel2_size>,
+                       (DCC_RX_BIDI_DEQUE_SIZE + dyns_per_frame - 1uz) /
+                         dyns_per_frame>
       dyn{};
     ztl::inplace_deque<bidi::Datagram<bidi::datagram_size<bidi::Bits::_48>>,
                        1uz>
@@ -1514,19 +2316,29 @@ private:
       xpom{};
   } _deques{};
 
+  Telemetry<DCC_RX_TELEMETRY_SIZE> _telemetry{};
+
+  /// Slot of packet currently received or last received
+  AddressedPacket* _current{&_deques.packet.prepare()};
+
   // Packets
   struct {
-    Packet current{}; ///< Current packet
-    Packet last{};    ///< Last executed packet
-    Packet pom{};     ///< Last executed POM packet
+    Packet last{}; ///< Last executed packet
+    Packet pom{};  ///< Last executed POM packet
   } _packets{};
 
   // Backoffs
   struct {
-    Backoff logon{};
-    Backoff search{};
+    BasicBackoff<G> logon{};
+    BasicBackoff<G> search{};
   } _backoffs{};
 
+  // Logon responses which depend on configuration, derived in thread mode
+  struct {
+    bidi::Datagram<> decoder_unique{}; ///< app:decoder_unique
+    bidi::Datagram<> short_info{};     ///< ShortInfo of logon select
+  } _logon_dgs{};
+
   // IDs
   struct {
     std::array<uint8_t, 4uz> decoder{}; ///< Decoder ID
@@ -1534,24 +2346,69 @@ private:
     std::array<uint8_t, 2uz> session{}; ///< Session ID
   } _ids{};
 
+  /// Raw address bytes of primary, consist and logon address
+  ///
+  /// Only ever written by updateFilter() in thread mode and read by filter()
+  /// in handler mode. Thread mode only writes the buffer which isn't published
+  /// and then publishes it with a release store of the index, handler mode
+  /// reads the published buffer after an acquire load. This relies on handler
+  /// mode not getting interrupted by thread mode, so that filter() always
+  /// completes before the buffer it reads gets written again. Logon changes
+  /// addresses in handler mode, it only marks the filter outdated and
+  /// housekeeping() updates it.
+  std::array<std::array<uint16_t, 3uz>, 2uz> _filters{};
+  std::atomic<size_t> _filter_index{}; ///< Written in thread mode
+  std::atomic<bool> _filter_outdated{}; ///< Written in both modes
+
+  /// Cached callback values of primary and consist address
+  std::array<CallbackState, 2uz> _callback_states{};
+  CallbackCounts _callback_counts{};
+
   Addresses _addrs{};     ///< Addresses
   Instruction _instr{};   ///< Current instruction
   uint8_t _byte{};        ///< Current byte
   uint8_t _checksum{};    ///< On-the-fly calculated checksum
   uint8_t _index_reg{1u}; ///< Paged mode index register
 
-  // Buffers
-  bidi::Channel1 _ch1{};
-  bidi::Channel2 _ch2{};
-
   uint8_t _qos{}; ///< Quality of service
 
-  enum State : uint8_t { Preamble, Startbit, Data, Endbit } _state{};
-  enum Mode : uint8_t { Operations, Service } _mode{};
+  enum State : uint8_t {
+    Preamble,
+    Startbit,
+    Data,
+    Endbit,
+    DataHalfbit,  ///< Only used by receiveTable
+    EndbitHalfbit ///< Only used by receiveTable
+  } _state{};
+  enum Action : uint8_t { Nothing, CheckPreamble, Begin, Shift, Complete };
+
+  /// State transition of receiveTable
+  struct Transition {
+    State state;
+    Action action;
+  };
+
+  /// State transitions of receiveTable indexed by state and bit
+  static constexpr std::array<std::array<Transition, 2uz>, 6uz> transitions{{
+    {{{Startbit, CheckPreamble}, {Preamble, Nothing}}},     // Preamble
+    {{{Data, Begin}, {Data, Begin}}},                       // Startbit
+    {{{DataHalfbit, Nothing}, {DataHalfbit, Nothing}}},     // Data
+    {{{EndbitHalfbit, Nothing}, {EndbitHalfbit, Nothing}}}, // Endbit
+    {{{Data, Shift}, {Data, Shift}}},                       // DataHalfbit
+    {{{Data, Nothing}, {Preamble, Complete}}},              // EndbitHalfbit
+  }};
+  enum Mode : uint8_t { Operations, Service };
+
+  // Shared between handler and thread mode
+  //
+  // Each of those is only ever written by one side. Flags and counts are
+  // accessed relaxed, they only need to be free of tearing. Packets themselves
+  // are published through the release/acquire indices of the packet queue.
+  std::atomic<Mode> _mode{};       ///< Written in thread mode
+  std::atomic<bool> _packet_end{}; ///< Written in handler mode
 
   // Not bitfields as those are most likely mutated in interrupt context
   bool _is_halfbit{};
-  bool _packet_end{};
   bool _ch1_addr_enabled{};
   bool _ch2_data_enabled{};
   bool _ch2_consist_enabled{};
@@ -1559,12 +2416,14 @@ private:
   bool _logon_selected{};
   bool _logon_assigned{};
   bool _logon_store{};
+  bool _maybe_service{};
 
   bool _enabled : 1 {};
   bool _cvs_locked : 1 {};
   bool _f0_exception : 1 {};
   bool _man : 1 {};
   bool _block_dyn_deque : 1 {};
+  bool _suppress_unchanged : 1 {};
 };
 
 } // namespace dcc::rx
@@ -0,0 +1,71 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Callback of asynchronous CV access
+///
+/// \file   dcc/rx/cv_callback.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace dcc::rx {
+
+/// Allocation-free callback of asynchronous CV access
+///
+/// Unlike std::function this never allocates. Callables are stored in place
+/// and must fit into two pointers. They also have to be trivially copyable,
+/// which lambdas capturing pointers, references and integers are.
+struct CvCallback {
+  static constexpr size_t capacity{2uz * sizeof(void*)};
+
+  constexpr CvCallback() = default;
+
+  /// Ctor
+  ///
+  /// \tparam F Type of callable
+  /// \param  f Callable
+  template<typename F>
+  requires(!std::same_as<F, CvCallback> && std::invocable<F const&, uint8_t>)
+  CvCallback(F f)
+    : _invoke{[](void const* storage, uint8_t byte) {
+        std::invoke(*std::launder(static_cast<F const*>(storage)), byte);
+      }} {
+    static_assert(sizeof(F) <= capacity, "Callable too large");
+    static_assert(alignof(F) <= alignof(void*), "Callable overaligned");
+    static_assert(std::is_trivially_copyable_v<F>,
+                  "Callable not trivially copyable");
+    std::construct_at(reinterpret_cast<F*>(data(_storage)), f);
+  }
+
+  /// Call callable
+  ///
+  /// \param  byte  CV value
+  void operator()(uint8_t byte) const {
+    assert(_invoke);
+    _invoke(data(_storage), byte);
+  }
+
+  /// Check if callable is stored
+  ///
+  /// \retval true  Callable stored
+  /// \retval false Empty
+  explicit constexpr operator bool() const { return _invoke; }
+
+private:
+  alignas(void*) std::array<std::byte, capacity> _storage{};
+  void (*_invoke)(void const*, uint8_t){};
+};
+
+} // namespace dcc::rx
@@ -0,0 +1,248 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Write-behind CV journal
+///
+/// \file   dcc/rx/cv_journal.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include "../crc8.hpp"
+#include "cv_callback.hpp"
+
+namespace dcc::rx {
+
+template<typename T>
+concept Flash = requires(T t,
+                         size_t addr,
+                         size_t sector,
+                         std::span<uint8_t> out,
+                         std::span<uint8_t const> in) {
+  { T::sector_size } -> std::convertible_to<size_t>;
+  { t.read(addr, out) } -> std::same_as<void>;
+  { t.program(addr, in) } -> std::same_as<void>;
+  { t.erase(sector) } -> std::same_as<void>;
+};
+
+/// Write-behind CV journal
+///
+/// Keeps all CVs in a RAM shadow. Writes only update the shadow and mark the
+/// CV dirty, so they return immediately. flush() appends dirty CVs as records
+/// to a log in flash, which is meant to be called when idle or from a
+/// power-fail hook.
+///
+/// The journal alternates between the first two sectors of the flash. Each
+/// sector starts with a sequence number, followed by an image of all CVs and
+/// records of 4 bytes (CV address, value and CRC8). If a sector runs full, the
+/// shadow is compacted into a fresh image in the other sector. The sequence
+/// number is programmed last, so the old sector stays valid until the new one
+/// is complete.
+///
+/// \tparam F Flash
+/// \tparam N Number of CVs
+template<Flash F, size_t N>
+struct CvJournal {
+  /// Ctor
+  ///
+  /// \param  flash Flash
+  explicit constexpr CvJournal(F& flash) : _flash{flash} {}
+
+  /// Load CVs from flash
+  ///
+  /// If neither sector contains a valid image, the defaults get written. A torn
+  /// record (e.g. power-fail during flush) ends the log and gets compacted away.
+  ///
+  /// \param  defaults  Default CV values
+  constexpr void load(std::span<uint8_t const, N> defaults) {
+    _dirty.reset();
+    auto const seqs{std::array{sequence(0uz), sequence(1uz)}};
+
+    // Format
+    if (seqs[0uz] == erased && seqs[1uz] == erased) {
+      std::ranges::copy(defaults, begin(_shadow));
+      _active = 1uz;
+      _seq = 0u;
+      return compact();
+    }
+
+    // Take the sector with the newer image
+    _active = seqs[1uz] != erased &&
+                  (seqs[0uz] == erased || seqs[1uz] > seqs[0uz])
+                ? 1uz
+                : 0uz;
+    _seq = seqs[_active];
+    _flash.read(base() + header_size, _shadow);
+
+    // Replay records until the first erased or torn one
+    std::array<uint8_t, record_size> record;
+    for (_tail = header_size + N; _tail + record_size <= F::sector_size;
+         _tail += record_size) {
+      _flash.read(base() + _tail, record);
+      auto const cv_addr{static_cast<size_t>(record[1uz]) << 8u |
+                         record[0uz]};
+      if (cv_addr >= N || crc8({cbegin(record), 3uz}) != record[3uz]) break;
+      _shadow[cv_addr] = record[2uz];
+    }
+
+    // Programming over a torn record can't clear its bits, start over instead
+    if (_tail + record_size <= F::sector_size &&
+        !std::ranges::all_of(record, [](uint8_t b) { return b == 0xFFu; }))
+      compact();
+  }
+
+  /// Read CV
+  ///
+  /// \param  cv_addr CV address
+  /// \return CV value
+  constexpr uint8_t readCv(uint32_t cv_addr, uint8_t = 0u) const {
+    return cv_addr < N ? _shadow[cv_addr] : 0u;
+  }
+
+  /// Read CV bit
+  ///
+  /// \param  cv_addr CV address
+  /// \param  pos     CV bit position
+  /// \return CV bit
+  constexpr bool readCv(uint32_t cv_addr, bool, uint32_t pos) const {
+    return readCv(cv_addr) & (1u << pos);
+  }
+
+  /// Write CV
+  ///
+  /// \param  cv_addr CV address
+  /// \param  byte    CV value
+  /// \return CV value
+  constexpr uint8_t writeCv(uint32_t cv_addr, uint8_t byte) {
+    if (cv_addr >= N) return 0u;
+    if (_shadow[cv_addr] != byte) {
+      _shadow[cv_addr] = byte;
+      _dirty.set(cv_addr);
+    }
+    return byte;
+  }
+
+  /// Write CV bit
+  ///
+  /// \param  cv_addr CV address
+  /// \param  bit     CV bit
+  /// \param  pos     CV bit position
+  /// \return CV bit
+  constexpr bool writeCv(uint32_t cv_addr, bool bit, uint32_t pos) {
+    auto const mask{1u << pos};
+    auto const byte{readCv(cv_addr)};
+    return writeCv(cv_addr,
+                   static_cast<uint8_t>(bit ? byte | mask : byte & ~mask)) &
+           mask;
+  }
+
+  /// Write CV asynchronously
+  ///
+  /// The callback gets executed immediately, writing to flash is deferred.
+  ///
+  /// \param  cv_addr CV address
+  /// \param  byte    CV value
+  /// \param  cb      Callback
+  constexpr void writeCv(uint32_t cv_addr, uint8_t byte, CvCallback cb) {
+    std::invoke(cb, writeCv(cv_addr, byte));
+  }
+
+  /// Write dirty CVs to flash
+  constexpr void flush() {
+    if (_dirty.none()) return;
+    else if (_tail + _dirty.count() * record_size > F::sector_size)
+      return compact();
+
+    // Program records in chunks
+    std::array<uint8_t, 16uz * record_size> chunk;
+    auto it{begin(chunk)};
+    for (auto cv_addr{0uz}; cv_addr < N; ++cv_addr) {
+      if (!_dirty.test(cv_addr)) continue;
+      std::array const record{static_cast<uint8_t>(cv_addr),
+                              static_cast<uint8_t>(cv_addr >> 8u),
+                              _shadow[cv_addr]};
+      it = std::ranges::copy(record, it).out;
+      *it++ = crc8(record);
+      if (it == end(chunk)) it = program(begin(chunk), it);
+    }
+    program(begin(chunk), it);
+    _dirty.reset();
+  }
+
+  /// Check if there are CVs not written to flash yet
+  ///
+  /// \retval true  CVs not written to flash yet
+  /// \retval false All CVs written to flash
+  constexpr bool dirty() const { return _dirty.any(); }
+
+private:
+  static constexpr size_t header_size{sizeof(uint32_t)};
+  static constexpr size_t record_size{4uz};
+  static constexpr uint32_t erased{0xFFFF'FFFFu};
+  static_assert(N <= 0xFFFFuz);
+  static_assert(F::sector_size >= header_size + N + record_size);
+
+  /// Get address of active sector
+  ///
+  /// \return Address of active sector
+  constexpr size_t base() const { return _active * F::sector_size; }
+
+  /// Read sequence number of sector
+  ///
+  /// \param  sector  Sector
+  /// \return Sequence number
+  constexpr uint32_t sequence(size_t sector) {
+    std::array<uint8_t, header_size> header;
+    _flash.read(sector * F::sector_size, header);
+    return static_cast<uint32_t>(header[0uz]) << 0u |
+           static_cast<uint32_t>(header[1uz]) << 8u |
+           static_cast<uint32_t>(header[2uz]) << 16u |
+           static_cast<uint32_t>(header[3uz]) << 24u;
+  }
+
+  /// Append records to log
+  ///
+  /// \param  first Beginning of records
+  /// \param  last  End of records
+  /// \return Beginning of records
+  constexpr auto program(auto first, auto last) {
+    if (first == last) return first;
+    std::span<uint8_t const> records{first, last};
+    _flash.program(base() + _tail, records);
+    _tail += size(records);
+    return first;
+  }
+
+  /// Write image of shadow to the other sector
+  constexpr void compact() {
+    _active = !_active;
+    _flash.erase(_active);
+    _flash.program(base() + header_size, _shadow);
+    ++_seq;
+    std::array const header{static_cast<uint8_t>(_seq >> 0u),
+                            static_cast<uint8_t>(_seq >> 8u),
+                            static_cast<uint8_t>(_seq >> 16u),
+                            static_cast<uint8_t>(_seq >> 24u)};
+    _flash.program(base(), header);
+    _tail = header_size + N;
+    _dirty.reset();
+  }
+
+  F& _flash;
+  std::array<uint8_t, N> _shadow{};
+  std::bitset<N> _dirty{};
+  size_t _active{};
+  size_t _tail{};
+  uint32_t _seq{};
+};
+
+} // namespace dcc::rx
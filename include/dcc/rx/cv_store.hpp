@@ -0,0 +1,159 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Sparse paged CV store
+///
+/// \file   dcc/rx/cv_store.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace dcc::rx {
+
+/// Sparse paged CV store covering 24-bit CV addresses
+///
+/// CVs are stored in pages of 256 bytes which get allocated from a fixed
+/// arena on first write. A directory indexed by bits 23-16 of the CV address
+/// points to page tables, which are indexed by bits 15-8 and point to pages.
+/// Every lookup therefore costs two array accesses. Reading CVs which were
+/// never written returns 0.
+///
+/// The indexed CVs 257-512 get mapped to CV31 << 16 | CV32 << 8 | (CV - 257),
+/// so e.g. the RailCom block (CV31=0 and CV32=255) ends up at 65296 and
+/// following, exactly where the logon CVs are expected by default. Pages with
+/// CV31=0 and CV32<4 overlap CV1-1024.
+///
+/// \tparam Pages   Number of pages in arena
+/// \tparam Tables  Number of page tables
+template<size_t Pages, size_t Tables = 2uz>
+struct CvStore {
+  static_assert(Pages && Pages < 256uz);
+  static_assert(Tables && Tables < 256uz);
+
+  static constexpr size_t page_size{256uz};
+
+  /// Memory usage
+  struct Usage {
+    size_t pages{};      ///< Allocated pages
+    size_t max_pages{};  ///< Pages in arena
+    size_t tables{};     ///< Allocated page tables
+    size_t max_tables{}; ///< Page tables in arena
+    size_t bytes{};      ///< Size of store in bytes
+  };
+
+  /// Read CV
+  ///
+  /// \param  cv_addr CV address
+  /// \return CV value
+  constexpr uint8_t readCv(uint32_t cv_addr, uint8_t = 0u) const {
+    auto const flat{translate(cv_addr)};
+    auto const page{lookup(flat)};
+    return page ? _pages[page - 1uz][flat & 0xFFu] : 0u;
+  }
+
+  /// Read CV bit
+  ///
+  /// \param  cv_addr CV address
+  /// \param  pos     CV bit position
+  /// \return CV bit
+  constexpr bool readCv(uint32_t cv_addr, bool, uint32_t pos) const {
+    return readCv(cv_addr) & (1u << pos);
+  }
+
+  /// Write CV
+  ///
+  /// \param  cv_addr CV address
+  /// \param  byte    CV value
+  /// \return CV value read back, old value (0) if arena is exhausted
+  constexpr uint8_t writeCv(uint32_t cv_addr, uint8_t byte) {
+    auto const flat{translate(cv_addr)};
+    auto page{lookup(flat)};
+    if (!page) {
+      if (!byte) return byte;
+      else if (!(page = allocate(flat))) {
+        assert(false && "CV store arena exhausted");
+        return readCv(cv_addr);
+      }
+    }
+    return _pages[page - 1uz][flat & 0xFFu] = byte;
+  }
+
+  /// Write CV bit
+  ///
+  /// \param  cv_addr CV address
+  /// \param  bit     CV bit
+  /// \param  pos     CV bit position
+  /// \return CV bit
+  constexpr bool writeCv(uint32_t cv_addr, bool bit, uint32_t pos) {
+    auto const mask{1u << pos};
+    auto const byte{readCv(cv_addr)};
+    return writeCv(cv_addr,
+                   static_cast<uint8_t>(bit ? byte | mask : byte & ~mask)) &
+           mask;
+  }
+
+  /// Get memory usage
+  ///
+  /// \return Memory usage
+  constexpr Usage usage() const {
+    return {.pages = _allocated.pages,
+            .max_pages = Pages,
+            .tables = _allocated.tables,
+            .max_tables = Tables,
+            .bytes = sizeof(*this)};
+  }
+
+private:
+  /// Translate CV address into flat 24-bit address
+  ///
+  /// \param  cv_addr CV address
+  /// \return Flat address
+  constexpr uint32_t translate(uint32_t cv_addr) const {
+    if (cv_addr < 256u || cv_addr >= 512u) return cv_addr & 0xFF'FFFFu;
+    auto const cv31{readCv(31u - 1u)};
+    auto const cv32{readCv(32u - 1u)};
+    return static_cast<uint32_t>(cv31) << 16u |
+           static_cast<uint32_t>(cv32) << 8u | (cv_addr & 0xFFu);
+  }
+
+  /// Look up page
+  ///
+  /// \param  flat  Flat address
+  /// \return 1-based page index, 0 if not allocated
+  constexpr size_t lookup(uint32_t flat) const {
+    auto const table{_directory[flat >> 16u]};
+    return table ? _tables[table - 1uz][(flat >> 8u) & 0xFFu] : 0uz;
+  }
+
+  /// Allocate page (and page table if necessary)
+  ///
+  /// \param  flat  Flat address
+  /// \return 1-based page index, 0 if arena is exhausted
+  constexpr size_t allocate(uint32_t flat) {
+    auto& table{_directory[flat >> 16u]};
+    if (!table) {
+      if (_allocated.tables == Tables || _allocated.pages == Pages) return 0uz;
+      table = static_cast<uint8_t>(++_allocated.tables);
+    }
+    if (_allocated.pages == Pages) return 0uz;
+    return _tables[table - 1uz][(flat >> 8u) & 0xFFu] =
+             static_cast<uint8_t>(++_allocated.pages);
+  }
+
+  std::array<uint8_t, 256uz> _directory{};
+  std::array<std::array<uint8_t, 256uz>, Tables> _tables{};
+  std::array<std::array<uint8_t, page_size>, Pages> _pages{};
+  struct {
+    size_t pages{};
+    size_t tables{};
+  } _allocated{};
+};
+
+} // namespace dcc::rx
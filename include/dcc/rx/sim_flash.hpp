@@ -0,0 +1,114 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Simulated flash
+///
+/// \file   dcc/rx/sim_flash.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <span>
+
+namespace dcc::rx {
+
+/// Host-side simulation of NOR flash
+///
+/// Erasing sets a whole sector to 0xFF, programming can only clear bits.
+/// Counts accesses, erases per sector (wear) and the time the accesses would
+/// have taken on a target.
+///
+/// \tparam SectorSize  Size of a sector in bytes
+/// \tparam SectorCount Number of sectors
+template<size_t SectorSize, size_t SectorCount>
+struct SimFlash {
+  static constexpr size_t sector_size{SectorSize};
+  static constexpr size_t sector_count{SectorCount};
+
+  /// Access latencies
+  struct Latencies {
+    std::chrono::microseconds erase{20'000}; ///< Per sector
+    std::chrono::microseconds program{10};   ///< Per byte
+    std::chrono::microseconds read{};        ///< Per byte
+  };
+
+  /// Counters
+  struct Counters {
+    size_t reads{};
+    size_t programs{};
+    size_t programmed_bytes{};
+    size_t erases{};
+    std::array<size_t, SectorCount> wear{}; ///< Erases per sector
+    std::chrono::microseconds busy{};       ///< Accumulated latency
+  };
+
+  /// Ctor
+  ///
+  /// \param  latencies Access latencies
+  constexpr SimFlash(Latencies latencies = {}) : _latencies{latencies} {
+    _memory.fill(0xFFu);
+  }
+
+  /// Read
+  ///
+  /// \param  addr  Address
+  /// \param  bytes Bytes
+  constexpr void read(size_t addr, std::span<uint8_t> bytes) {
+    assert(addr + size(bytes) <= size(_memory));
+    std::ranges::copy_n(cbegin(_memory) + static_cast<ptrdiff_t>(addr),
+                        std::ssize(bytes),
+                        begin(bytes));
+    ++_counters.reads;
+    _counters.busy += _latencies.read * std::ssize(bytes);
+  }
+
+  /// Program
+  ///
+  /// \param  addr  Address
+  /// \param  bytes Bytes
+  constexpr void program(size_t addr, std::span<uint8_t const> bytes) {
+    assert(addr + size(bytes) <= size(_memory));
+    for (auto i{0uz}; i < size(bytes); ++i) _memory[addr + i] &= bytes[i];
+    ++_counters.programs;
+    _counters.programmed_bytes += size(bytes);
+    _counters.busy += _latencies.program * std::ssize(bytes);
+  }
+
+  /// Erase
+  ///
+  /// \param  sector  Sector
+  constexpr void erase(size_t sector) {
+    assert(sector < SectorCount);
+    std::ranges::fill_n(
+      begin(_memory) + static_cast<ptrdiff_t>(sector * SectorSize),
+      static_cast<ptrdiff_t>(SectorSize),
+      0xFFu);
+    ++_counters.erases;
+    ++_counters.wear[sector];
+    _counters.busy += _latencies.erase;
+  }
+
+  /// Get counters
+  ///
+  /// \return Counters
+  constexpr Counters const& counters() const { return _counters; }
+
+  /// Get raw memory, e.g. to simulate torn writes
+  ///
+  /// \return Memory
+  constexpr std::span<uint8_t> memory() { return _memory; }
+
+private:
+  std::array<uint8_t, SectorSize * SectorCount> _memory;
+  Latencies _latencies;
+  Counters _counters{};
+};
+
+} // namespace dcc::rx
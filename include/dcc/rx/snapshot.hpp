@@ -0,0 +1,80 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Snapshot of configuration derived from CVs
+///
+/// \file   dcc/rx/snapshot.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "../address.hpp"
+#include "../crc8.hpp"
+
+namespace dcc::rx {
+
+/// Configuration derived from CVs
+///
+/// Plain old data which can be persisted next to the CVs and restored without
+/// reading them one by one. The revision of the CVs the snapshot was taken
+/// from ties it to their content.
+struct Snapshot {
+  enum Flags : uint8_t {
+    Ch1AddrEnabled = 1u << 0u,
+    Ch2DataEnabled = 1u << 1u,
+    Ch2ConsistEnabled = 1u << 2u,
+    LogonEnabled = 1u << 3u,
+    CvsLocked = 1u << 4u,
+    F0Exception = 1u << 5u,
+  };
+
+  Address primary{};
+  Address consist{};
+  Address logon{};
+  std::array<uint8_t, 4uz> did{}; ///< Decoder ID
+  uint16_t cid{};                 ///< Command station ID
+  uint8_t sid{};                  ///< Session ID
+  uint8_t flags{};
+  uint32_t revision{}; ///< Revision of CVs, supplied by application
+  uint8_t crc{};       ///< Checksum
+
+  friend constexpr bool operator==(Snapshot const&, Snapshot const&) = default;
+};
+
+static_assert(std::is_trivially_copyable_v<Snapshot>);
+
+/// Calculate checksum of snapshot
+///
+/// The checksum is the inverted CRC8 of all members except crc itself, so that
+/// a snapshot consisting of zeros only is never valid.
+///
+/// \param  snapshot  Snapshot
+/// \return Checksum
+constexpr uint8_t checksum(Snapshot const& snapshot) {
+  std::array<uint8_t, 24uz> bytes;
+  auto it{begin(bytes)};
+  for (auto const& addr :
+       {snapshot.primary, snapshot.consist, snapshot.logon}) {
+    *it++ = static_cast<uint8_t>(addr.value >> 8u);
+    *it++ = static_cast<uint8_t>(addr.value);
+    *it++ = addr.type;
+    *it++ = addr.reversed;
+  }
+  it = std::ranges::copy(snapshot.did, it).out;
+  *it++ = static_cast<uint8_t>(snapshot.cid >> 8u);
+  *it++ = static_cast<uint8_t>(snapshot.cid);
+  *it++ = snapshot.sid;
+  *it++ = snapshot.flags;
+  *it++ = static_cast<uint8_t>(snapshot.revision >> 24u);
+  *it++ = static_cast<uint8_t>(snapshot.revision >> 16u);
+  *it++ = static_cast<uint8_t>(snapshot.revision >> 8u);
+  *it++ = static_cast<uint8_t>(snapshot.revision);
+  return static_cast<uint8_t>(~crc8(bytes));
+}
+
+} // namespace dcc::rx
@@ -0,0 +1,155 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Single-producer single-consumer queue
+///
+/// \file   dcc/rx/spsc_queue.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace dcc::rx {
+
+/// Wait-free single-producer single-consumer queue
+///
+/// The producer (handler mode) only ever writes the tail index, the consumer
+/// (thread mode) only ever writes the head index. Publishing an index is a
+/// release store, observing the other side's index an acquire load. Neither
+/// side ever needs a read-modify-write operation, so this works on cores
+/// without exclusive load/store as well.
+///
+/// There is one slot more than the capacity. The slot at the tail index is
+/// therefore never visible to the consumer, not even if the queue is full, and
+/// the producer can assemble the next element right there. Indices run through
+/// [0, N] and the queue is full if advancing the tail would reach the head.
+/// This replaces the indices through [0, 2N) of the first version, which had
+/// no spare slot to assemble in.
+///
+/// \tparam T Type of elements
+/// \tparam N Capacity
+template<typename T, size_t N>
+struct SpscQueue {
+  static_assert(N);
+  static_assert(std::atomic<size_t>::is_always_lock_free);
+
+  using value_type = T;
+  using size_type = size_t;
+  using reference = value_type&;
+  using const_reference = value_type const&;
+
+  /// Add element to the end (producer)
+  ///
+  /// \param  value Element
+  /// \retval true  Element added
+  /// \retval false Queue full, element dropped
+  constexpr bool push_back(const_reference value) {
+    prepare() = value;
+    return commit();
+  }
+
+  /// Access slot behind last element (producer)
+  ///
+  /// \return Slot which gets added by commit()
+  constexpr reference prepare() {
+    return _buf[_tail.load(std::memory_order_relaxed)];
+  }
+
+  /// Add prepared slot to the end (producer)
+  ///
+  /// \retval true  Slot added
+  /// \retval false Queue full, slot dropped
+  constexpr bool commit() {
+    auto const tail{next(_tail.load(std::memory_order_relaxed))};
+    if (tail == _head.load(std::memory_order_acquire)) return false;
+    _tail.store(tail, std::memory_order_release);
+    return true;
+  }
+
+  /// Access first element (consumer)
+  ///
+  /// \return First element
+  constexpr const_reference front() const {
+    return _buf[_head.load(std::memory_order_relaxed)];
+  }
+
+  /// Access element (consumer)
+  ///
+  /// \param  pos Position relative to first element
+  /// \return Element
+  constexpr const_reference operator[](size_type pos) const {
+    auto const i{_head.load(std::memory_order_relaxed) + pos};
+    return _buf[i > N ? i - N - 1uz : i];
+  }
+
+  /// Remove first element (consumer)
+  constexpr void pop_front() {
+    _head.store(next(_head.load(std::memory_order_relaxed)),
+                std::memory_order_release);
+  }
+
+  /// Remove all elements (consumer)
+  constexpr void clear() {
+    _head.store(_tail.load(std::memory_order_acquire),
+                std::memory_order_release);
+  }
+
+  /// Get capacity
+  ///
+  /// \return Capacity
+  static constexpr size_type max_size() { return N; }
+
+  /// Get number of elements
+  ///
+  /// \param  queue Queue
+  /// \return Number of elements
+  friend constexpr size_type size(SpscQueue const& queue) {
+    return distance(queue._head.load(std::memory_order_acquire),
+                    queue._tail.load(std::memory_order_acquire));
+  }
+
+  /// Check whether queue is empty
+  ///
+  /// \param  queue Queue
+  /// \retval true  Queue is empty
+  /// \retval false Queue is not empty
+  friend constexpr bool empty(SpscQueue const& queue) { return !size(queue); }
+
+  /// Check whether queue is full
+  ///
+  /// \param  queue Queue
+  /// \retval true  Queue is full
+  /// \retval false Queue is not full
+  friend constexpr bool full(SpscQueue const& queue) {
+    return size(queue) == N;
+  }
+
+private:
+  /// Get next index
+  ///
+  /// \param  i Index
+  /// \return Next index
+  static constexpr size_type next(size_type i) {
+    return i == N ? 0uz : i + 1uz;
+  }
+
+  /// Get number of elements between two indices
+  ///
+  /// \param  head  Head index
+  /// \param  tail  Tail index
+  /// \return Number of elements
+  static constexpr size_type distance(size_type head, size_type tail) {
+    return tail >= head ? tail - head : tail + N + 1uz - head;
+  }
+
+  std::array<value_type, N + 1uz> _buf{};
+  std::atomic<size_type> _head{}; ///< Only written by consumer
+  std::atomic<size_type> _tail{}; ///< Only written by producer
+};
+
+} // namespace dcc::rx
@@ -0,0 +1,153 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Telemetry scheduler for app:dyn datagrams
+///
+/// \file   dcc/rx/telemetry.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include "../bidi/app/dyn.hpp"
+#include "clock.hpp"
+
+namespace dcc::rx {
+
+/// Telemetry scheduler for app:dyn datagrams
+///
+/// Sources get registered with a target update period and a priority, the
+/// application then only sets their latest values. Whenever a channel 2 slot
+/// is available, the due sources with the highest priority get pulled, the
+/// most overdue ones first. The achieved update period of each source is
+/// tracked as moving average. Only differences of time points are used, so
+/// wrap-around of the clock doesn't matter.
+///
+/// \tparam N Maximum number of sources
+/// \tparam C Clock of time points
+template<size_t N, typename C = Clock>
+struct Telemetry {
+  using duration = C::duration;
+  using time_point = C::time_point;
+
+  /// Statistics of a source
+  struct Stats {
+    size_t count{};    ///< Number of pulled values
+    duration period{}; ///< Achieved update period
+  };
+
+  /// Add source
+  ///
+  /// \param  period    Target update period
+  /// \param  priority  Priority (higher gets pulled first)
+  /// \return Index of source, N if registry is full
+  constexpr size_t add(duration period, uint8_t priority = 0u) {
+    if (_size == N) return N;
+    _sources[_size] = {.period = period, .priority = priority};
+    return _size++;
+  }
+
+  /// Set latest value of source
+  ///
+  /// \param  i   Index of source
+  /// \param  dyn Value
+  constexpr void set(size_t i, bidi::app::Dyn dyn) {
+    assert(i < _size);
+    _sources[i].dyn = dyn;
+    _sources[i].valid = true;
+  }
+
+  /// Pull values of due sources
+  ///
+  /// \param  now Current time point
+  /// \param  out Values
+  /// \return Number of pulled values
+  constexpr size_t pull(time_point now, std::span<bidi::app::Dyn> out) {
+    std::bitset<N> pulled{};
+    auto count{0uz};
+    for (; count < out.size(); ++count) {
+      // Highest priority first, most overdue second
+      auto best{_size};
+      duration best_overdue{};
+      for (auto i{0uz}; i < _size; ++i) {
+        auto const& src{_sources[i]};
+        if (!src.valid || pulled.test(i)) continue;
+        // Sources which were never pulled are due anyway
+        auto const elapsed{src.stats.count ? now - src.last : duration::max()};
+        if (elapsed < src.period) continue;
+        else if (auto const overdue{elapsed - src.period};
+                 best == _size || src.priority > _sources[best].priority ||
+                 (src.priority == _sources[best].priority &&
+                  overdue > best_overdue)) {
+          best = i;
+          best_overdue = overdue;
+        }
+      }
+      if (best == _size) break;
+      pulled.set(best);
+      out[count] = pull(_sources[best], now);
+    }
+    return count;
+  }
+
+  /// Get statistics of source
+  ///
+  /// \param  i Index of source
+  /// \return Statistics
+  constexpr Stats const& stats(size_t i) const {
+    assert(i < _size);
+    return _sources[i].stats;
+  }
+
+  /// Get number of sources
+  ///
+  /// \return Number of sources
+  constexpr size_t size() const { return _size; }
+
+private:
+  using signed_duration =
+    std::chrono::duration<std::make_signed_t<typename duration::rep>,
+                          typename duration::period>;
+
+  struct Source {
+    duration period{};
+    uint8_t priority{};
+    bidi::app::Dyn dyn{};
+    bool valid{};
+    time_point last{};
+    Stats stats{};
+  };
+
+  /// Pull value of source and schedule next update
+  ///
+  /// \param  src Source
+  /// \param  now Current time point
+  /// \return Value
+  constexpr bidi::app::Dyn pull(Source& src, time_point now) {
+    // Moving average with a weight of 1/8, first period is taken as is. The
+    // period might shrink, so average with a signed representation.
+    if (signed_duration const period{now - src.last}; src.stats.count > 1uz) {
+      signed_duration const avg{src.stats.period};
+      src.stats.period =
+        std::chrono::duration_cast<duration>(avg + (period - avg) / 8);
+    } else if (src.stats.count)
+      src.stats.period = std::chrono::duration_cast<duration>(period);
+    ++src.stats.count;
+    src.last = now;
+    return src.dyn;
+  }
+
+  std::array<Source, N> _sources{};
+  size_t _size{};
+};
+
+} // namespace dcc::rx
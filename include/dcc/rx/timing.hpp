@@ -11,7 +11,9 @@
 #pragma once
 
 #include <cstdint>
+#include <ratio>
 #include "../bit.hpp"
+#include "../ticks.hpp"
 
 namespace dcc::rx {
 
@@ -27,11 +29,17 @@ enum Timing {
 
 /// Convert time to bit
 ///
-/// \param  time  Time in µs
+/// \tparam Period  Duration of a timer tick in seconds
+/// \param  time    Time in timer ticks
 /// \return Bit
+template<typename Period = std::micro>
 constexpr Bit time2bit(uint32_t time) {
-  if (time >= Bit1Min && time <= Bit1Max) return _1;
-  else if (time >= Bit0Min && time <= Bit0MaxAnalog) return _0;
+  constexpr auto bit1_min{us2ticks<Period>(Bit1Min)};
+  constexpr auto bit1_max{us2ticks<Period>(Bit1Max)};
+  constexpr auto bit0_min{us2ticks<Period>(Bit0Min)};
+  constexpr auto bit0_max_analog{us2ticks<Period>(Bit0MaxAnalog)};
+  if (time >= bit1_min && time <= bit1_max) return _1;
+  else if (time >= bit0_min && time <= bit0_max_analog) return _0;
   else return Invalid;
 }
 
@@ -0,0 +1,44 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Timer ticks
+///
+/// \file   dcc/ticks.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <cstdint>
+#include <ratio>
+
+namespace dcc {
+
+/// Convert µs to timer ticks (rounded to nearest)
+///
+/// \tparam Period  Duration of a timer tick in seconds
+/// \param  us      Duration in µs
+/// \return Duration in timer ticks
+template<typename Period = std::micro>
+constexpr uint32_t us2ticks(uint32_t us) {
+  using ratio = std::ratio_divide<std::micro, Period>;
+  return static_cast<uint32_t>((static_cast<uint64_t>(us) * ratio::num +
+                                ratio::den / 2u) /
+                               ratio::den);
+}
+
+/// Convert timer ticks to µs (rounded to nearest)
+///
+/// \tparam Period  Duration of a timer tick in seconds
+/// \param  ticks   Duration in timer ticks
+/// \return Duration in µs
+template<typename Period = std::micro>
+constexpr uint32_t ticks2us(uint32_t ticks) {
+  using ratio = std::ratio_divide<Period, std::micro>;
+  return static_cast<uint32_t>((static_cast<uint64_t>(ticks) * ratio::num +
+                                ratio::den / 2u) /
+                               ratio::den);
+}
+
+} // namespace dcc
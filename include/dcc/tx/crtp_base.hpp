@@ -10,17 +10,24 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <concepts>
+#include <limits>
+#include <ratio>
 #include <span>
 #include <utility>
+#include <variant>
 #include <ztl/inplace_deque.hpp>
 #include "../bidi/datagram.hpp"
 #include "../bidi/timing.hpp"
+#include "../ticks.hpp"
 #include "../utility.hpp"
 #include "addresses.hpp"
 #include "command_station.hpp"
 #include "config.hpp"
+#include "packet_ring.hpp"
+#include "symbol.hpp"
 #include "timings.hpp"
 #include "timings_adapter.hpp"
 
@@ -28,16 +35,31 @@ namespace dcc::tx {
 
 /// CRTP base for transmitting DCC
 ///
-/// \tparam T Type to downcast to
-/// \tparam D Deque value type
-template<typename T, typename D = Packet>
-requires(std::same_as<D, Packet> || std::same_as<D, Timings>)
+/// \tparam T       Type to downcast to
+/// \tparam D       Deque value type or packet ring
+/// \tparam Period  Duration of a timer tick in seconds
+template<typename T, typename D = Packet, typename Period = std::micro>
+requires(std::same_as<D, Packet> || std::same_as<D, Timings> ||
+         std::same_as<D, PacketRing>)
 struct CrtpBase {
   friend T;
 
-  using value_type = std::pair<
-    Address,
-    std::conditional_t<std::same_as<D, Packet>, TimingsAdapter, Timings>>;
+  // Longest half bit and BiDi timing must fit into Timings::value_type
+  static_assert(us2ticks<Period>(std::max<uint32_t>(
+                  {Bit1Max,
+                   Bit0Max,
+                   bidi::Timing::TCS,
+                   bidi::Timing::TTS1 - bidi::Timing::TCS,
+                   bidi::Timing::TTS2 - bidi::Timing::TTS1,
+                   bidi::Timing::TTC2 - bidi::Timing::TTS2,
+                   bidi::Timing::TCE - bidi::Timing::TTC2})) <=
+                std::numeric_limits<Timings::value_type>::max());
+
+  using value_type =
+    std::pair<Address,
+              std::conditional_t<std::same_as<D, Timings>,
+                                 Timings,
+                                 TimingsAdapter>>;
 
   /// Initialize
   ///
@@ -50,10 +72,9 @@ struct CrtpBase {
            cfg.bit0_duration >= Bit0Min && cfg.bit0_duration <= Bit0Max);  //
     _cfg = cfg;
     _idle_packet.first = _addrs.current = decode_address(packet);
-    if constexpr (std::same_as<D, Packet>)
-      _idle_packet.second = TimingsAdapter{packet, _cfg};
-    else if constexpr (std::same_as<D, Timings>)
-      _idle_packet.second = bytes2timings(packet, _cfg);
+    if constexpr (std::same_as<D, Timings>)
+      _idle_packet.second = bytes2timings<Period>(packet, _cfg);
+    else _idle_packet.second = TimingsAdapter{packet, _cfg, Period{}};
     _first = begin(_idle_packet.second);
     _last = cend(_idle_packet.second);
     _idle = true;
@@ -74,15 +95,13 @@ struct CrtpBase {
   /// \retval true  Bytes added to deque
   /// \retval false Bytes not added to deque
   bool bytes(std::span<uint8_t const> bytes) {
-    if (full(_deque)) return false;
     assert(std::size(bytes) <= DCC_MAX_PACKET_SIZE);
-    pushBack(bytes);
-    return true;
+    return pushBack(bytes);
   }
 
-  /// Get next bit duration to transmit in µs
+  /// Get next bit duration to transmit in timer ticks
   ///
-  /// \return Bit duration in µs
+  /// \return Bit duration in timer ticks
   Timings::value_type transmit() {
     // Packet timings
     if (_first != _last) return packetTiming();
@@ -97,20 +116,54 @@ struct CrtpBase {
     if (_cfg.flags.bidi && _bidi_count <= 4uz) return biDiTiming();
     else _bidi_count = 0uz;
 
-    // Only pop if packet came from deque
-    if (!_idle) {
-      assert(!empty(_deque));
-      _deque.pop_front();
+    // Next packet
+    nextPacket();
+    return packetTiming();
+  }
+
+  /// Get next full bit period to transmit
+  ///
+  /// Alternative to transmit() for timers which generate symmetric periods on
+  /// their own. Track outputs are not toggled and the BiDi cutout is returned
+  /// as a single asymmetric symbol. biDiStart() is called with the cutout
+  /// symbol, biDiEnd() with the first symbol of the following packet. Channel
+  /// timings are left to the timer.
+  ///
+  /// \return Full bit period
+  Symbol transmitSymbol() {
+    // Packet symbols
+    if (_first != _last) return packetSymbol();
+
+    // Packet end and cutout
+    if (!_bidi_count) {
+      if constexpr (requires(T t) {
+                      { t.packetEnd() };
+                    })
+        impl().packetEnd();
+      if (_cfg.flags.bidi) {
+        _bidi_count = 1uz;
+        if constexpr (requires(T t) {
+                        { t.biDiStart() };
+                      })
+          impl().biDiStart();
+        return {.first = us2ticks<Period>(bidi::Timing::TCS),
+                .second =
+                  us2ticks<Period>(bidi::Timing::TCE - bidi::Timing::TCS),
+                .cutout = true};
+      }
+    }
+    // Cutout end
+    else {
+      _bidi_count = 0uz;
+      if constexpr (requires(T t) {
+                      { t.biDiEnd() };
+                    })
+        impl().biDiEnd();
     }
 
     // Next packet
-    _idle = empty(_deque);
-    auto& packet{_idle ? _idle_packet : _deque.front()};
-    _addrs.last = _addrs.current;
-    _addrs.current = packet.first;
-    _first = begin(packet.second);
-    _last = cend(packet.second);
-    return packetTiming();
+    nextPacket();
+    return packetSymbol();
   }
 
   /// Get deque size
@@ -120,8 +173,11 @@ struct CrtpBase {
 
   /// Get deque capacity
   ///
-  /// \return Deque capacity
-  constexpr auto capacity() const { return DCC_TX_DEQUE_SIZE; }
+  /// \return Deque capacity (in bytes for packet ring)
+  constexpr auto capacity() const {
+    if constexpr (std::same_as<D, PacketRing>) return PacketRing::capacity();
+    else return DCC_TX_DEQUE_SIZE;
+  }
 
   /// Get address of last transmission
   ///
@@ -143,6 +199,34 @@ private:
     return retval;
   }
 
+  /// Packet symbol
+  ///
+  /// \return Next symbol from current packet
+  Symbol packetSymbol() {
+    // Both halves of a bit are equal
+    auto const retval{*_first};
+    ++_first;
+    ++_first;
+    return {.first = retval, .second = retval};
+  }
+
+  /// Switch to next packet in deque or idle packet
+  void nextPacket() {
+    // Only pop if packet came from deque
+    if (!_idle) {
+      assert(!empty(_deque));
+      _deque.pop_front();
+    }
+
+    // Next packet
+    _idle = empty(_deque);
+    auto& packet{_idle ? _idle_packet : front()};
+    _addrs.last = _addrs.current;
+    _addrs.current = packet.first;
+    _first = begin(packet.second);
+    _last = cend(packet.second);
+  }
+
   /// BiDi timing
   ///
   /// \return Next BiDi timing
@@ -151,7 +235,7 @@ private:
       // Send half a 1 bit
       case 0uz:
         toggleTrackOutputs();
-        return static_cast<Timings::value_type>(bidi::Timing::TCS);
+        return biDiTicks(bidi::Timing::TCS);
 
       // Cutout start
       case 1uz:
@@ -160,8 +244,7 @@ private:
                         { t.biDiStart() };
                       })
           impl().biDiStart();
-        return static_cast<Timings::value_type>(bidi::Timing::TTS1 -
-                                                bidi::Timing::TCS);
+        return biDiTicks(bidi::Timing::TTS1 - bidi::Timing::TCS);
 
       // Channel 1 start
       case 2uz:
@@ -169,8 +252,7 @@ private:
                         { t.biDiChannel1() };
                       })
           impl().biDiChannel1();
-        return static_cast<Timings::value_type>(bidi::Timing::TTS2 -
-                                                bidi::Timing::TTS1);
+        return biDiTicks(bidi::Timing::TTS2 - bidi::Timing::TTS1);
 
       // Channel 2 start
       case 3uz:
@@ -178,8 +260,7 @@ private:
                         { t.biDiChannel2() };
                       })
           impl().biDiChannel2();
-        return static_cast<Timings::value_type>(bidi::Timing::TTC2 -
-                                                bidi::Timing::TTS2);
+        return biDiTicks(bidi::Timing::TTC2 - bidi::Timing::TTS2);
 
       // Cutout end
       default:
@@ -187,19 +268,44 @@ private:
                         { t.biDiEnd() };
                       })
           impl().biDiEnd();
-        return static_cast<Timings::value_type>(bidi::Timing::TCE -
-                                                bidi::Timing::TTC2);
+        return biDiTicks(bidi::Timing::TCE - bidi::Timing::TTC2);
     }
   }
 
+  /// Convert BiDi timing to timer ticks
+  ///
+  /// \param  us  BiDi timing in µs
+  /// \return BiDi timing in timer ticks
+  static constexpr Timings::value_type biDiTicks(uint32_t us) {
+    return static_cast<Timings::value_type>(us2ticks<Period>(us));
+  }
+
   /// Add packet or timings to deque
   ///
   /// \param  bytes Bytes containing DCC packet
-  void pushBack(std::span<uint8_t const> bytes) {
-    if constexpr (std::same_as<D, Packet>)
-      _deque.push_back({decode_address(bytes), {bytes, _cfg}});
+  /// \retval true  Bytes added to deque
+  /// \retval false Bytes not added to deque
+  bool pushBack(std::span<uint8_t const> bytes) {
+    if constexpr (std::same_as<D, PacketRing>)
+      return _deque.push_back(bytes, _cfg);
+    else if (full(_deque)) return false;
+    else if constexpr (std::same_as<D, Packet>)
+      _deque.push_back({decode_address(bytes), {bytes, _cfg, Period{}}});
     else if constexpr (std::same_as<D, Timings>)
-      _deque.push_back({decode_address(bytes), bytes2timings(bytes, _cfg)});
+      _deque.push_back(
+        {decode_address(bytes), bytes2timings<Period>(bytes, _cfg)});
+    return true;
+  }
+
+  /// Get first packet or timings of deque
+  ///
+  /// \return First packet or timings of deque
+  value_type& front() {
+    if constexpr (std::same_as<D, PacketRing>) {
+      auto const [packet, cfg]{_deque.front()};
+      _front = {decode_address(packet), TimingsAdapter{packet, cfg, Period{}}};
+      return _front;
+    } else return _deque.front();
   }
 
   /// Toggle track outputs
@@ -214,7 +320,15 @@ private:
   }
 
   /// Deque
-  ztl::inplace_deque<value_type, DCC_TX_DEQUE_SIZE> _deque{};
+  std::conditional_t<std::same_as<D, PacketRing>,
+                     PacketRing,
+                     ztl::inplace_deque<value_type, DCC_TX_DEQUE_SIZE>>
+    _deque{};
+
+  /// First packet of packet ring
+  [[no_unique_address]] std::conditional_t<std::same_as<D, PacketRing>,
+                                           value_type,
+                                           std::monostate> _front{};
 
   /// Idle packet
   value_type _idle_packet{};
@@ -0,0 +1,151 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Ring of length-prefixed packets
+///
+/// \file   dcc/tx/packet_ring.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <climits>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include "../packet.hpp"
+#include "config.hpp"
+
+namespace dcc::tx {
+
+/// Stores packets as length-prefixed bytes in a byte ring
+///
+/// Each entry consists of a single header byte followed by the packet bytes.
+/// The lower 5 bits of the header contain the packet length, the upper 3 bits
+/// an index into a small table of configurations. Capacity is therefore
+/// measured in bytes rather than packets.
+///
+/// \tparam N Size of the ring in bytes
+template<size_t N>
+struct BasicPacketRing {
+  static_assert(DCC_MAX_PACKET_SIZE < (1uz << 5uz));
+  static_assert(N > DCC_MAX_PACKET_SIZE && N <= UINT16_MAX);
+
+  using value_type = std::pair<Packet, Config>;
+  using size_type = uint16_t;
+
+  /// Add packet
+  ///
+  /// \param  bytes Bytes containing DCC packet
+  /// \param  cfg   Configuration
+  /// \retval true  Packet added to ring
+  /// \retval false Packet not added to ring
+  constexpr bool push_back(std::span<uint8_t const> bytes, Config cfg) {
+    assert(std::size(bytes) <= DCC_MAX_PACKET_SIZE);
+    if (!fits(std::size(bytes))) return false;
+    auto const i{configIndex(cfg)};
+    if (i >= std::size(_cfgs)) return false;
+    ++_refs[i];
+    push(static_cast<uint8_t>(i << 5uz | std::size(bytes)));
+    for (auto const byte : bytes) push(byte);
+    ++_size;
+    return true;
+  }
+
+  /// Get oldest packet and its configuration
+  ///
+  /// \return Packet and configuration
+  constexpr value_type front() const {
+    assert(_size);
+    auto const header{_buf[_head]};
+    value_type retval{Packet{}, _cfgs[header >> 5u]};
+    for (auto i{1uz}; i <= (header & 0x1Fu); ++i)
+      retval.first.push_back(_buf[(_head + i) % N]);
+    return retval;
+  }
+
+  /// Remove oldest packet
+  constexpr void pop_front() {
+    assert(_size);
+    auto const header{_buf[_head]};
+    --_refs[header >> 5u];
+    auto const count{1uz + (header & 0x1Fu)};
+    _head = static_cast<size_type>((_head + count) % N);
+    _used = static_cast<size_type>(_used - count);
+    --_size;
+  }
+
+  /// Check whether packet of certain size fits into ring
+  ///
+  /// \param  count Number of packet bytes
+  /// \retval true  Packet fits
+  /// \retval false Packet doesn't fit
+  constexpr bool fits(size_t count) const { return _used + 1uz + count <= N; }
+
+  /// Get number of packets
+  ///
+  /// \return Number of packets
+  constexpr size_type size() const { return _size; }
+
+  /// Get number of used bytes
+  ///
+  /// \return Number of used bytes
+  constexpr size_type bytes() const { return _used; }
+
+  /// Get capacity in bytes
+  ///
+  /// \return Capacity in bytes
+  static constexpr size_type capacity() { return N; }
+
+  /// Remove all packets
+  constexpr void clear() {
+    _refs = {};
+    _head = _used = _size = 0u;
+  }
+
+  friend constexpr bool empty(BasicPacketRing const& ring) {
+    return !ring._size;
+  }
+  friend constexpr auto size(BasicPacketRing const& ring) {
+    return ring.size();
+  }
+
+private:
+  /// Get index of configuration, add it to the table if necessary
+  ///
+  /// \param  cfg Configuration
+  /// \return Index of configuration or table size if table is exhausted
+  constexpr size_t configIndex(Config cfg) {
+    // Reuse referenced entry
+    for (auto i{0uz}; i < std::size(_cfgs); ++i)
+      if (_refs[i] && _cfgs[i] == cfg) return i;
+    // ...otherwise take first unreferenced one
+    auto const i{static_cast<size_t>(std::ranges::find(_refs, 0u) -
+                                     std::cbegin(_refs))};
+    if (i < std::size(_cfgs)) _cfgs[i] = cfg;
+    return i;
+  }
+
+  /// Push single byte
+  ///
+  /// \param  byte  Byte
+  constexpr void push(uint8_t byte) {
+    _buf[(_head + _used) % N] = byte;
+    ++_used;
+  }
+
+  std::array<uint8_t, N> _buf{};      ///< Headers and bytes
+  std::array<Config, 8uz> _cfgs{};    ///< Configurations
+  std::array<size_type, 8uz> _refs{}; ///< Configuration reference counts
+  size_type _head{};                  ///< Index of oldest header
+  size_type _used{};                  ///< Number of used bytes
+  size_type _size{};                  ///< Number of packets
+};
+
+using PacketRing = BasicPacketRing<DCC_TX_PACKET_RING_SIZE>;
+
+} // namespace dcc::tx
@@ -0,0 +1,29 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Transmit symbol
+///
+/// \file   dcc/tx/symbol.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <cstdint>
+
+namespace dcc::tx {
+
+/// Full bit period
+///
+/// Preamble and data bits are symmetric (first == second). The BiDi cutout is
+/// an asymmetric symbol made of half a 1-bit followed by the cutout itself.
+struct Symbol {
+  friend constexpr bool operator==(Symbol const&, Symbol const&) = default;
+
+  uint32_t first{};  ///< Duration of first half in timer ticks
+  uint32_t second{}; ///< Duration of second half in timer ticks
+  bool cutout{};     ///< Second half is BiDi cutout
+};
+
+} // namespace dcc::tx
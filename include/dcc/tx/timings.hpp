@@ -14,9 +14,11 @@
 #include <array>
 #include <climits>
 #include <cstdint>
+#include <ratio>
 #include <span>
 #include <ztl/inplace_vector.hpp>
 #include "../packet.hpp"
+#include "../ticks.hpp"
 #include "config.hpp"
 
 namespace dcc::tx {
@@ -30,33 +32,37 @@ using Timings =
 
 /// Convert bytes into timings
 ///
-/// \param  bytes Bytes
-/// \param  cfg   Configuration
-/// \return Timings
+/// \tparam Period  Duration of a timer tick in seconds
+/// \param  bytes   Bytes
+/// \param  cfg     Configuration
+/// \return Timings in timer ticks
+template<typename Period = std::micro>
 constexpr Timings bytes2timings(std::span<uint8_t const> bytes,
                                 Config cfg = {}) {
   Timings timings{};
   auto first{begin(timings)};
+  auto const bit1{
+    static_cast<Timings::value_type>(us2ticks<Period>(cfg.bit1_duration))};
+  auto const bit0{
+    static_cast<Timings::value_type>(us2ticks<Period>(cfg.bit0_duration))};
 
   // Preamble
   auto const preamble_count{cfg.num_preamble * 2uz};
-  first =
-    std::ranges::fill_n(first,
-                        static_cast<Timings::difference_type>(preamble_count),
-                        cfg.bit1_duration);
+  first = std::ranges::fill_n(
+    first, static_cast<Timings::difference_type>(preamble_count), bit1);
 
   // Data
   for (auto const byte : bytes) {
     // Startbit
-    first = std::ranges::fill_n(first, 2uz, cfg.bit0_duration);
+    first = std::ranges::fill_n(first, 2uz, bit0);
     for (auto i{CHAR_BIT}; i-- > 0;) {
-      auto const bit{byte & (1u << i) ? cfg.bit1_duration : cfg.bit0_duration};
+      auto const bit{byte & (1u << i) ? bit1 : bit0};
       first = std::ranges::fill_n(first, 2uz, bit);
     }
   }
 
   // Endbit
-  first = std::ranges::fill_n(first, 2uz, cfg.bit1_duration);
+  first = std::ranges::fill_n(first, 2uz, bit1);
 
   // Size
   timings.resize(static_cast<Timings::size_type>(
@@ -67,11 +73,13 @@ constexpr Timings bytes2timings(std::span<uint8_t const> bytes,
 
 /// Convert packet into timings
 ///
+/// \tparam Period  Duration of a timer tick in seconds
 /// \param  packet  Packet
 /// \param  cfg     Configuration
-/// \return Timings
+/// \return Timings in timer ticks
+template<typename Period = std::micro>
 constexpr Timings packet2timings(Packet const& packet, Config cfg = {}) {
-  return bytes2timings({cbegin(packet), size(packet)}, cfg);
+  return bytes2timings<Period>({cbegin(packet), size(packet)}, cfg);
 }
 
 } // namespace dcc::tx
@@ -13,7 +13,9 @@
 #include <cstdint>
 #include <iterator>
 #include <ranges>
+#include <ratio>
 #include <span>
+#include "../ticks.hpp"
 #include "timings.hpp"
 
 namespace dcc::tx {
@@ -61,9 +63,8 @@ struct TimingsAdapter : std::ranges::view_interface<TimingsAdapter> {
 
     constexpr reference operator*() const {
       // Preamble
-      auto const& cfg{_ptr->_cfg};
-      auto const preamble_count{cfg.num_preamble * 2uz};
-      if (_count < preamble_count) return cfg.bit1_duration;
+      auto const preamble_count{_ptr->_num_preamble * 2uz};
+      if (_count < preamble_count) return _ptr->_bit1;
 
       // Count without preamble
       auto i{_count - preamble_count};
@@ -72,17 +73,17 @@ struct TimingsAdapter : std::ranges::view_interface<TimingsAdapter> {
       auto const& packet{_ptr->_packet};
       auto const byte_index{
         static_cast<Packet::size_type>(i / ((1uz + CHAR_BIT) * 2uz))};
-      if (byte_index >= std::size(packet)) return cfg.bit1_duration;
+      if (byte_index >= std::size(packet)) return _ptr->_bit1;
 
       // Index of current half bit
       auto const hbit_index{i % ((1uz + CHAR_BIT) * 2uz)};
-      if (hbit_index < 2uz) return cfg.bit0_duration;
+      if (hbit_index < 2uz) return _ptr->_bit0;
 
       // Index of current bit
       auto const bit_index{(hbit_index - 2uz) / 2uz};
       return packet[byte_index] & 1u << (CHAR_BIT - 1uz - bit_index)
-               ? cfg.bit1_duration
-               : cfg.bit0_duration;
+               ? _ptr->_bit1
+               : _ptr->_bit0;
     }
 
     constexpr bool operator==(std::default_sentinel_t) const {
@@ -107,16 +108,25 @@ struct TimingsAdapter : std::ranges::view_interface<TimingsAdapter> {
 
   // Construct/copy/destroy
   constexpr TimingsAdapter() = default;
-  constexpr TimingsAdapter(Packet const& packet, Config cfg)
-    : _packet{packet}, _cfg{cfg},
+  template<typename Period = std::micro>
+  constexpr TimingsAdapter(Packet const& packet, Config cfg, Period = {})
+    : _packet{packet}, _bit1{static_cast<value_type>(
+                         us2ticks<Period>(cfg.bit1_duration))},
+      _bit0{static_cast<value_type>(us2ticks<Period>(cfg.bit0_duration))},
       _max_count{static_cast<size_type>(
-        (_cfg.num_preamble + std::size(_packet) * (1uz + CHAR_BIT) + 1uz) *
-        2uz)} {}
-  constexpr TimingsAdapter(std::span<uint8_t const> bytes, Config cfg)
-    : _cfg{cfg},
+        (cfg.num_preamble + std::size(_packet) * (1uz + CHAR_BIT) + 1uz) *
+        2uz)},
+      _num_preamble{cfg.num_preamble} {}
+  template<typename Period = std::micro>
+  constexpr TimingsAdapter(std::span<uint8_t const> bytes,
+                           Config cfg,
+                           Period = {})
+    : _bit1{static_cast<value_type>(us2ticks<Period>(cfg.bit1_duration))},
+      _bit0{static_cast<value_type>(us2ticks<Period>(cfg.bit0_duration))},
       _max_count{static_cast<size_type>(
-        (_cfg.num_preamble + std::size(bytes) * (1uz + CHAR_BIT) + 1uz) *
-        2uz)} {
+        (cfg.num_preamble + std::size(bytes) * (1uz + CHAR_BIT) + 1uz) *
+        2uz)},
+      _num_preamble{cfg.num_preamble} {
     std::ranges::copy(bytes, std::back_inserter(_packet));
   }
 
@@ -132,8 +142,10 @@ struct TimingsAdapter : std::ranges::view_interface<TimingsAdapter> {
 
 private:
   Packet _packet;
-  Config _cfg{};
+  value_type _bit1{}; ///< Duration of half a 1-bit in timer ticks
+  value_type _bit0{}; ///< Duration of half a 0-bit in timer ticks
   size_type _max_count{};
+  uint8_t _num_preamble{};
 };
 
 constexpr auto begin(TimingsAdapter& c) -> decltype(c.begin()) {
@@ -11,10 +11,12 @@
 #pragma once
 
 #include <static_math/static_math.h>
+#include <algorithm>
 #include <cassert>
 #include <concepts>
 #include <cstdint>
 #include <cstring>
+#include <span>
 #include <utility>
 #include <ztl/enum.hpp>
 #include <ztl/math.hpp>
@@ -1538,10 +1540,13 @@ make_logon_enable_packet(LogonGroup gg, uint16_t cid, uint8_t session_id) {
 ///
 /// \param  manufacturer_id Manufacturer ID
 /// \param  did             Unique ID
+/// \param  subcommand      Subcommand
+/// \param  data            Parameters of subcommand
 /// \return LOGON_SELECT packet
 constexpr auto make_logon_select_packet(uint16_t manufacturer_id,
                                         uint32_t did,
-                                        uint8_t subcommand = 0b1111'1111u) {
+                                        uint8_t subcommand = 0b1111'1111u,
+                                        std::span<uint8_t const> data = {}) {
   Packet packet{};
   auto first{begin(packet)};
   auto last{encode_address({254u, Address::AutomaticLogon}, first)};
@@ -1549,6 +1554,7 @@ constexpr auto make_logon_select_packet(uint16_t manufacturer_id,
   *last++ = static_cast<uint8_t>(manufacturer_id);
   last = uint32_2data(did, last);
   *last++ = subcommand;
+  last = std::ranges::copy(data, last).out;
   *last = crc8({first, last});
   ++last;
   *last = exor({first, last});
@@ -15,13 +15,22 @@ TEST_F(RxTest, speed_direction_and_functions_f23_f0) {
   EXPECT_CALL(_mock, direction(_addrs.primary.value, dcc::Forward));
   EXPECT_CALL(_mock,
               speed(_addrs.primary.value, dcc::scale_speed<126>(10 - 1)));
-  EXPECT_CALL(_mock, function(_addrs.primary.value, 0xFFu << 0u, 1u << 0u));
-  EXPECT_CALL(_mock, function(_addrs.primary.value, 0xFFu << 8u, 2u << 8u));
-  EXPECT_CALL(_mock, function(_addrs.primary.value, 0xFFu << 16u, 3u << 16u));
+  EXPECT_CALL(_mock, function(_addrs.primary.value, 0xFF'FFFFu, 0x03'0201u));
   ReceiveAndExecute(make_speed_direction_and_functions_packet(
     _addrs.primary, dcc::Forward << 7u | 10u, 1u, 2u, 3u));
 }
 
+// Speed, direction and functions F31-F0, F31-F24 must not reuse mask of F7-F0
+TEST_F(RxTest, speed_direction_and_functions_f31_f0) {
+  EXPECT_CALL(_mock, direction(_addrs.primary.value, dcc::Forward));
+  EXPECT_CALL(_mock,
+              speed(_addrs.primary.value, dcc::scale_speed<126>(10 - 1)));
+  EXPECT_CALL(_mock,
+              function(_addrs.primary.value, 0xFFFF'FFFFu, 0x8003'0201u));
+  ReceiveAndExecute(make_speed_direction_and_functions_packet(
+    _addrs.primary, dcc::Forward << 7u | 10u, 1u, 2u, 3u, 0x80u));
+}
+
 // 126 speed steps command forward
 TEST_F(RxTest, _126_speed_steps) {
   EXPECT_CALL(_mock, direction(_addrs.primary.value, dcc::Forward));
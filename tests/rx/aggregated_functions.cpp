@@ -0,0 +1,75 @@
+#include "rx_test.hpp"
+
+using dcc::rx::Functions;
+
+namespace {
+
+// Mock which gets all functions through the aggregated callback
+struct AggregatedRxMock : dcc::rx::CrtpBase<AggregatedRxMock>, RxMockMethods {
+  MOCK_METHOD(void, functions, (uint16_t, Functions, Functions), ());
+};
+
+static_assert(dcc::rx::AggregatedFunctions<AggregatedRxMock>);
+static_assert(!dcc::rx::AggregatedFunctions<RxMock>);
+
+struct RxAggregatedFunctionsTest : BasicRxTest<AggregatedRxMock> {
+  RxAggregatedFunctionsTest() {
+    EXPECT_CALL(_mock, function(_, _, _)).Times(0);
+  }
+};
+
+} // namespace
+
+TEST_F(RxAggregatedFunctionsTest, speed_direction_and_functions_in_one_call) {
+  EXPECT_CALL(_mock,
+              functions(_addrs.primary.value,
+                        Functions{0xFFFF'FFFFull},
+                        Functions{0x0403'0201ull}));
+  ReceiveAndExecute(dcc::make_speed_direction_and_functions_packet(
+    _addrs.primary, dcc::Forward << 7u | 10u, 1u, 2u, 3u, 4u));
+}
+
+TEST_F(RxAggregatedFunctionsTest, feature_expansion_f29_f60) {
+  EXPECT_CALL(_mock,
+              functions(_addrs.primary.value,
+                        Functions{0xFFu} << 29uz,
+                        Functions{0x12u} << 29uz));
+  EXPECT_CALL(_mock,
+              functions(_addrs.primary.value,
+                        Functions{0xFFu} << 37uz,
+                        Functions{0x34u} << 37uz));
+  EXPECT_CALL(_mock,
+              functions(_addrs.primary.value,
+                        Functions{0xFFu} << 45uz,
+                        Functions{0x56u} << 45uz));
+  EXPECT_CALL(_mock,
+              functions(_addrs.primary.value,
+                        Functions{0xFFu} << 53uz,
+                        Functions{0x78u} << 53uz));
+  ReceiveAndExecute(dcc::make_f29_f36_packet(_addrs.primary, 0x12u));
+  ReceiveAndExecute(dcc::make_f37_f44_packet(_addrs.primary, 0x34u));
+  ReceiveAndExecute(dcc::make_f45_f52_packet(_addrs.primary, 0x56u));
+  ReceiveAndExecute(dcc::make_f53_f60_packet(_addrs.primary, 0x78u));
+}
+
+TEST_F(RxAggregatedFunctionsTest, feature_expansion_f61_f68) {
+  auto const state{RandomInterval<uint8_t>(0u, 255u)};
+  Functions mask{};
+  for (auto i{61uz}; i <= 68uz; ++i) mask.set(i);
+  EXPECT_CALL(_mock,
+              functions(_addrs.primary.value, mask, Functions{state} << 61uz));
+  ReceiveAndExecute(dcc::make_f61_f68_packet(_addrs.primary, state));
+}
+
+TEST_F(RxAggregatedFunctionsTest, feature_expansion_f64_f68) {
+  Functions state{};
+  state.set(64uz).set(66uz).set(68uz);
+  EXPECT_CALL(_mock, functions(_addrs.primary.value, _, state));
+  ReceiveAndExecute(dcc::make_f61_f68_packet(_addrs.primary, 0b1010'1000u));
+}
+
+TEST_F(RxTest, feature_expansion_f61_f68_without_aggregated_functions) {
+  // Decoders without aggregated functions only get F0-F31
+  EXPECT_CALL(_mock, function(_, _, _)).Times(0);
+  ReceiveAndExecute(dcc::make_f61_f68_packet(_addrs.primary, 0xFFu));
+}
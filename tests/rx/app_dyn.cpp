@@ -73,3 +73,32 @@ TEST_F(RxTest, dont_transmit_following_foreign_address) {
   EXPECT_CALL(_mock, transmitBiDi(_)).Times(0);
   _mock.biDiChannel2();
 }
+
+TEST_F(RxTest, app_dyn_pack_into_last_frame) {
+  // Send whatever packet to get last received address to match primary
+  Receive(make_f0_f4_packet(_addrs.primary, 10u));
+
+  // QoS and first datagram fill a frame, second and third share the next one
+  _mock.datagram(DirectionStatusByte{1u}, DirectionStatusByte{2u});
+  _mock.datagram(DirectionStatusByte{3u});
+
+  {
+    auto qos{make_app_dyn_datagram(0u, 7u)};
+    auto first{make_app_dyn_datagram(1u, 27u)};
+    std::vector<uint8_t> datagram;
+    std::ranges::copy(qos, std::back_inserter(datagram));
+    std::ranges::copy(first, std::back_inserter(datagram));
+    EXPECT_CALL(_mock, transmitBiDi(DatagramMatcher(datagram))).Times(1);
+    _mock.biDiChannel2();
+  }
+
+  {
+    auto second{make_app_dyn_datagram(2u, 27u)};
+    auto third{make_app_dyn_datagram(3u, 27u)};
+    std::vector<uint8_t> datagram;
+    std::ranges::copy(second, std::back_inserter(datagram));
+    std::ranges::copy(third, std::back_inserter(datagram));
+    EXPECT_CALL(_mock, transmitBiDi(DatagramMatcher(datagram))).Times(1);
+    _mock.biDiChannel2();
+  }
+}
@@ -9,7 +9,7 @@ TEST_F(RxTest, app_pom) {
   EXPECT_CALL(_mock,
               readCv(Matcher<uint32_t>(cv_addr),
                      Matcher<uint8_t>(_),
-                     Matcher<std::function<void(uint8_t)>>(_)))
+                     Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(value));
 
   auto packet{make_cv_access_long_verify_packet(_addrs.primary, cv_addr)};
@@ -30,7 +30,7 @@ TEST_F(RxTest, app_pom_disabled_with_cv28_1) {
   EXPECT_CALL(_mock,
               readCv(Matcher<uint32_t>(cv_addr),
                      Matcher<uint8_t>(_),
-                     Matcher<std::function<void(uint8_t)>>(_)))
+                     Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(value));
 
   auto packet{make_cv_access_long_verify_packet(_addrs.primary, cv_addr)};
@@ -47,7 +47,7 @@ TEST_F(RxTest, app_pom_reply_on_any_packets) {
   EXPECT_CALL(_mock,
               readCv(Matcher<uint32_t>(cv_addr),
                      Matcher<uint8_t>(_),
-                     Matcher<std::function<void(uint8_t)>>(_)))
+                     Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(value));
 
   auto packet{make_cv_access_long_verify_packet(_addrs.primary, cv_addr)};
@@ -69,7 +69,7 @@ TEST_F(RxTest, app_pom_clear_internal_queue_on_unknown_cv_access_packet) {
   EXPECT_CALL(_mock,
               readCv(Matcher<uint32_t>(cv_addr),
                      Matcher<uint8_t>(_),
-                     Matcher<std::function<void(uint8_t)>>(_)))
+                     Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(value));
 
   auto packet{make_cv_access_long_verify_packet(_addrs.primary, cv_addr)};
@@ -81,7 +81,7 @@ TEST_F(RxTest, app_pom_clear_internal_queue_on_unknown_cv_access_packet) {
   EXPECT_CALL(_mock,
               readCv(Matcher<uint32_t>(cv_addr + 1u),
                      Matcher<uint8_t>(_),
-                     Matcher<std::function<void(uint8_t)>>(_)));
+                     Matcher<dcc::rx::CvCallback>(_)));
 
   auto other_cv_packet{
     make_cv_access_long_verify_packet(_addrs.primary, cv_addr + 1u)};
@@ -71,7 +71,7 @@ TEST_F(
   EXPECT_CALL(_mock, transmitBiDi(DatagramMatcher(datagram))).Times(1);
   _mock.biDiChannel2();
 
-  std::this_thread::sleep_for(1s);
+  Wait(1s);
 
   // Make sure to get past backoff (see RCN-218)
   for (auto i{0.0}; i < 30.0 / 10E-3; ++i)
@@ -83,7 +83,8 @@ TEST_F(
 }
 
 TEST_F(RxTest, app_search_address_change_must_clear_deque) {
-  EXPECT_CALL(_mock, readCv(_)).BASIC_ADDRESS_READ_CV_INIT_SEQUENCE();
+  EXPECT_CALL(_mock, readCv(29u - 1u)).WillOnce(Return(_cvs[29uz - 1uz]));
+  EXPECT_CALL(_mock, readCv(1u - 1u)).WillOnce(Return(7u));
 
   // Make sure to get past backoff (see RCN-218)
   for (auto i{0.0}; i < 30.0 / 10E-3; ++i)
@@ -109,9 +110,8 @@ TEST_F(RxTest, app_search_not_answered_after_30s) {
   SetUp();
 
   // Send whatever for at least 30s
-  for (auto const then{std::chrono::system_clock::now() + 31s};
-       std::chrono::system_clock::now() < then;)
-    ReceiveAndExecute(
+  for (auto t{0ms}; t < 31s; t += 10ms)
+    Wait(10ms)->ReceiveAndExecute(
       make_speed_and_direction_packet(_addrs.primary, 1u << 5u | 0b0100u));
 
   // Make sure to get past backoff (see RCN-218)
@@ -130,13 +130,12 @@ TEST_F(RxTest, app_search_resets_after_at_least_1s_without_signal) {
   SetUp();
 
   // Send whatever for at least 30s
-  for (auto const then{std::chrono::system_clock::now() + 31s};
-       std::chrono::system_clock::now() < then;)
-    ReceiveAndExecute(
+  for (auto t{0ms}; t < 31s; t += 10ms)
+    Wait(10ms)->ReceiveAndExecute(
       make_speed_and_direction_packet(_addrs.primary, 1u << 5u | 0b0100u));
 
   // Simulate lost signal
-  std::this_thread::sleep_for(2s);
+  Wait(2s);
 
   // Make sure to get past backoff (see RCN-218)
   for (auto i{0.0}; i < 30.0 / 10E-3; ++i)
@@ -149,3 +148,31 @@ TEST_F(RxTest, app_search_resets_after_at_least_1s_without_signal) {
   EXPECT_CALL(_mock, transmitBiDi(DatagramMatcher(datagram))).Times(1);
   _mock.biDiChannel2();
 }
+
+TEST_F(RxTest, app_search_at_tick_0_keeps_its_time) {
+  // Initialize 1.5s before the clock wraps
+  _mock._now = static_cast<uint32_t>(-1500);
+  SetUp();
+  for (auto i{0uz}; i < 3uz; ++i)
+    Wait(500ms)->ReceiveAndExecute(
+      make_speed_and_direction_packet(_addrs.primary, 1u << 5u | 0b0100u));
+  ASSERT_EQ(_mock._now, 0u);
+
+  // First search at tick 0
+  for (auto i{0.0}; i < 30.0 / 10E-3; ++i)
+    LeaveCutout()->Execute()->Receive(
+      dcc::make_binary_state_short_packet(0u, 2u, false));
+  auto datagram{make_app_search_datagram(_addrs.primary, 0u, 1u)};
+  EXPECT_CALL(_mock, transmitBiDi(DatagramMatcher(datagram))).Times(1);
+  _mock.biDiChannel2();
+
+  // Later searches still report the time of the first one
+  for (auto i{0uz}; i < 2uz; ++i)
+    Wait(900ms)->ReceiveAndExecute(
+      make_speed_and_direction_packet(_addrs.primary, 1u << 5u | 0b0100u));
+  for (auto i{0.0}; i < 30.0 / 10E-3; ++i)
+    LeaveCutout()->Execute()->Receive(
+      dcc::make_binary_state_short_packet(0u, 2u, false));
+  EXPECT_CALL(_mock, transmitBiDi(DatagramMatcher(datagram))).Times(1);
+  _mock.biDiChannel2();
+}
@@ -32,3 +32,25 @@ TEST_F(BackoffTest, now) {
   EXPECT_FALSE(static_cast<bool>(_backoff));
   EXPECT_LT(CountTillFalse(CHAR_BIT), CHAR_BIT);
 }
+
+TEST_F(BackoffTest, same_seed_same_sequence) {
+  dcc::rx::Backoff a{dcc::rx::Xorshift32{0xAABBCCDDu}};
+  dcc::rx::Backoff b{dcc::rx::Xorshift32{0xAABBCCDDu}};
+  for (auto i{0uz}; i < 1000uz; ++i)
+    EXPECT_EQ(static_cast<bool>(a), static_cast<bool>(b));
+}
+
+TEST_F(BackoffTest, injectable_generator) {
+  // Generator which always returns the maximum
+  struct Max {
+    using result_type = uint32_t;
+    static constexpr result_type min() { return 0u; }
+    static constexpr result_type max() { return 255u; }
+    constexpr result_type operator()() { return max(); }
+  };
+  dcc::rx::BasicBackoff<Max> backoff;
+  EXPECT_FALSE(static_cast<bool>(backoff));
+  for (auto i{0}; i < CHAR_BIT - 1; ++i)
+    EXPECT_TRUE(static_cast<bool>(backoff));
+  EXPECT_FALSE(static_cast<bool>(backoff));
+}
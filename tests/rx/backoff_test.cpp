@@ -2,10 +2,7 @@
 #include <random>
 
 BackoffTest::BackoffTest() {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<unsigned int> dist(0, RAND_MAX);
-  srand(dist(gen));
+  _backoff.generator().seed(std::random_device{}());
 }
 
 BackoffTest::~BackoffTest() {}
@@ -0,0 +1,134 @@
+#include <numeric>
+#include "rx_test.hpp"
+
+namespace {
+
+// Mock with a block of RAM which can be read and written in chunks
+struct BlockRxMock : dcc::rx::CrtpBase<BlockRxMock>, RxMockMethods {
+  MOCK_METHOD(bool, readBlock, (uint16_t, (std::span<uint8_t, 4uz>)), ());
+  MOCK_METHOD(bool,
+              writeBlock,
+              (uint16_t, (std::span<uint8_t const, 4uz>)),
+              ());
+};
+
+static_assert(dcc::rx::BlockReadable<BlockRxMock>);
+static_assert(dcc::rx::BlockWritable<BlockRxMock>);
+static_assert(!dcc::rx::BlockReadable<RxMock>);
+static_assert(!dcc::rx::BlockWritable<RxMock>);
+
+struct RxBlockTransferTest : BasicRxTest<BlockRxMock> {
+  RxBlockTransferTest() {
+    ON_CALL(_mock, readBlock(_, _))
+      .WillByDefault([this](uint16_t index, std::span<uint8_t, 4uz> bytes) {
+        if (index * size(bytes) >= size(_block)) return false;
+        std::ranges::copy_n(
+          &_block[index * size(bytes)], ssize(bytes), begin(bytes));
+        return true;
+      });
+    ON_CALL(_mock, writeBlock(_, _))
+      .WillByDefault(
+        [this](uint16_t index, std::span<uint8_t const, 4uz> bytes) {
+          if (index * size(bytes) >= size(_block)) return false;
+          std::ranges::copy(bytes, &_block[index * size(bytes)]);
+          return true;
+        });
+    ON_CALL(_mock, transmitBiDi(_))
+      .WillByDefault([this](std::span<uint8_t const> bytes) {
+        std::ranges::copy(bytes, std::back_inserter(_bidi));
+      });
+  }
+
+  // Send LOGON_SELECT and return decoded response
+  std::optional<std::array<uint8_t, 5uz>>
+  Select(uint8_t subcommand, std::span<uint8_t const> data) {
+    _bidi.clear();
+    Receive(dcc::make_logon_select_packet(
+              DCC_MANUFACTURER_ID, _did, subcommand, data))
+      ->BiDi()
+      ->LeaveCutout();
+
+    EXPECT_EQ(size(_bidi), dcc::bidi::datagram_size<dcc::bidi::Bits::_48>);
+    dcc::bidi::Datagram<> encoded{};
+    std::ranges::copy_n(cbegin(_bidi), ssize(encoded), begin(encoded));
+    if (std::ranges::all_of(encoded,
+                            [](uint8_t b) { return b == dcc::bidi::nak; }))
+      return std::nullopt;
+
+    // Check CRC8 framing
+    auto const data48{
+      dcc::bidi::make_data(dcc::bidi::decode_datagram(encoded))};
+    std::array<uint8_t, 5uz> chunk;
+    for (auto i{0uz}; i < size(chunk); ++i)
+      chunk[i] = static_cast<uint8_t>(data48 >> (40uz - i * 8uz));
+    EXPECT_EQ(dcc::crc8(chunk), static_cast<uint8_t>(data48));
+    return chunk;
+  }
+
+  // Read chunk
+  std::optional<std::array<uint8_t, 5uz>> Read(uint16_t index) {
+    std::array const data{static_cast<uint8_t>(index >> 8u),
+                          static_cast<uint8_t>(index)};
+    return Select(0b1111'1110u, data);
+  }
+
+  // Write chunk
+  std::optional<std::array<uint8_t, 5uz>>
+  Write(uint16_t index, std::span<uint8_t const, 4uz> bytes) {
+    std::array<uint8_t, 2uz + 4uz> data{static_cast<uint8_t>(index >> 8u),
+                                        static_cast<uint8_t>(index)};
+    std::ranges::copy(bytes, begin(data) + 2);
+    return Select(0b1111'1100u, data);
+  }
+
+  std::array<uint8_t, 4096uz> _block{};
+  std::vector<uint8_t> _bidi;
+};
+
+} // namespace
+
+TEST_F(RxBlockTransferTest, loopback) {
+  std::vector<uint8_t> block(size(_block));
+  std::iota(begin(block), end(block), uint8_t{42u});
+
+  // Push block in chunks of 4 bytes, each one gets echoed
+  for (auto i{0uz}; i < size(block) / 4uz; ++i) {
+    std::span<uint8_t const, 4uz> const chunk{&block[i * 4uz], 4uz};
+    auto const response{Write(static_cast<uint16_t>(i), chunk)};
+    ASSERT_TRUE(response);
+    EXPECT_EQ((*response)[0uz], static_cast<uint8_t>(i));
+    EXPECT_TRUE(std::ranges::equal(std::span{*response}.subspan(1uz), chunk));
+  }
+  EXPECT_TRUE(std::ranges::equal(_block, block));
+
+  // Pull it again
+  std::vector<uint8_t> pulled;
+  for (auto i{0uz}; i < size(block) / 4uz; ++i) {
+    auto const response{Read(static_cast<uint16_t>(i))};
+    ASSERT_TRUE(response);
+    EXPECT_EQ((*response)[0uz], static_cast<uint8_t>(i));
+    std::ranges::copy(std::span{*response}.subspan(1uz),
+                      std::back_inserter(pulled));
+  }
+  EXPECT_EQ(pulled, block);
+}
+
+TEST_F(RxBlockTransferTest, nak_out_of_range) {
+  auto const index{static_cast<uint16_t>(size(_block) / 4uz)};
+  EXPECT_FALSE(Read(index));
+  EXPECT_FALSE(Write(index, std::array<uint8_t, 4uz>{}));
+}
+
+TEST_F(RxBlockTransferTest, nak_missing_index) {
+  EXPECT_FALSE(Select(0b1111'1110u, {}));
+}
+
+TEST_F(RxTest, block_read_without_concept_naks) {
+  std::array const index{uint8_t{0u}, uint8_t{0u}};
+  Receive(dcc::make_logon_select_packet(
+    DCC_MANUFACTURER_ID, _did, 0b1111'1110u, index));
+  std::array<uint8_t, 6uz> naks;
+  naks.fill(dcc::bidi::nak);
+  EXPECT_CALL(_mock, transmitBiDi(DatagramMatcher(naks)));
+  BiDiChannel2();
+}
@@ -0,0 +1,56 @@
+#include "rx_test.hpp"
+
+namespace {
+
+// Mock which reads and writes consecutive CVs in one go
+struct BulkRxMock : dcc::rx::CrtpBase<BulkRxMock>, RxMockMethods {
+  MOCK_METHOD(void, readCvs, (uint32_t, std::span<uint8_t>), ());
+  MOCK_METHOD(void, writeCvs, (uint32_t, std::span<uint8_t const>), ());
+};
+
+static_assert(dcc::rx::BulkReadable<BulkRxMock>);
+static_assert(dcc::rx::BulkWritable<BulkRxMock>);
+static_assert(!dcc::rx::BulkReadable<RxMock>);
+static_assert(!dcc::rx::BulkWritable<RxMock>);
+
+struct RxBulkCvsTest : BasicRxTest<BulkRxMock> {
+  // IDs and logon address get read in one go, which doesn't match the init
+  // sequence of RxTest
+  void SetUp() override {
+    ON_CALL(_mock, readCv(_)).WillByDefault([this](uint32_t cv_addr) {
+      return _cvs[cv_addr];
+    });
+    ON_CALL(_mock, readCvs(_, _))
+      .WillByDefault([this](uint32_t cv_addr, std::span<uint8_t> bytes) {
+        std::ranges::copy_n(&_cvs[cv_addr], std::ssize(bytes), begin(bytes));
+      });
+    ON_CALL(_mock, writeCvs(_, _))
+      .WillByDefault([this](uint32_t cv_addr, std::span<uint8_t const> bytes) {
+        std::ranges::copy(bytes, &_cvs[cv_addr]);
+      });
+    _mock.init();
+  }
+};
+
+} // namespace
+
+TEST_F(RxBulkCvsTest, xpom_verify_reads_all_bytes_at_once) {
+  auto const cv_addr{100u};
+  EXPECT_CALL(_mock, readCv(_)).Times(0);
+  EXPECT_CALL(_mock, readCvs(cv_addr, SizeIs(4uz)));
+  ReceiveAndExecute(
+    dcc::make_cv_access_xpom_verify_packet(_addrs.primary, 0b00u, cv_addr));
+}
+
+TEST_F(RxBulkCvsTest, xpom_write_writes_all_bytes_at_once) {
+  auto const cv_addr{100u};
+  auto const packet{dcc::make_cv_access_xpom_write_packet(
+    _addrs.primary, 0b01u, cv_addr, 0x12u, 0x34u)};
+  EXPECT_CALL(_mock, writeCv(_, Matcher<uint8_t>(_))).Times(0);
+  EXPECT_CALL(_mock, readCv(_)).Times(0);
+  EXPECT_CALL(_mock, writeCvs(cv_addr, ElementsAre(0x12u, 0x34u)));
+  EXPECT_CALL(_mock, readCvs(cv_addr, SizeIs(4uz)));
+  ReceiveAndExecuteTwice(packet);
+  EXPECT_EQ(_cvs[cv_addr + 0uz], 0x12u);
+  EXPECT_EQ(_cvs[cv_addr + 1uz], 0x34u);
+}
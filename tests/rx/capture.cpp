@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <dcc/dcc.hpp>
+#include <ratio>
+#include <vector>
+#include "rx_mock.hpp"
+
+using namespace ::testing;
+
+namespace {
+
+using Ticks80MHz = std::ratio<1, 80'000'000>;
+
+} // namespace
+
+TEST(RxCapture, time2bit_in_ticks) {
+  EXPECT_EQ(dcc::rx::time2bit<Ticks80MHz>(dcc::rx::Bit1 * 80u), dcc::_1);
+  EXPECT_EQ(dcc::rx::time2bit<Ticks80MHz>(dcc::rx::Bit0 * 80u), dcc::_0);
+  EXPECT_EQ(dcc::rx::time2bit<Ticks80MHz>(dcc::rx::Bit1Min * 80u - 1u),
+            dcc::Invalid);
+  EXPECT_EQ(dcc::rx::time2bit<Ticks80MHz>(dcc::rx::Bit1Max * 80u), dcc::_1);
+  EXPECT_EQ(dcc::rx::time2bit<Ticks80MHz>(dcc::rx::Bit0MaxAnalog * 80u + 1u),
+            dcc::Invalid);
+}
+
+TEST(RxCapture, wraparound) {
+  {
+    dcc::rx::Capture<uint16_t> capture;
+    EXPECT_EQ(capture(65500u), 65500u);
+    EXPECT_EQ(capture(65535u), 35u);
+    EXPECT_EQ(capture(20u), 21u);
+  }
+
+  {
+    // Timer with ARR=9999
+    dcc::rx::Capture<uint16_t, 9999u> capture;
+    EXPECT_EQ(capture(9990u), 9990u);
+    EXPECT_EQ(capture(48u), 58u);
+  }
+
+  {
+    dcc::rx::Capture<> capture;
+    std::vector<uint32_t> timestamps{0xFFFF'FFC0u, 0xFFFF'FFFAu, 52u};
+    capture(timestamps);
+    EXPECT_EQ(timestamps, (std::vector<uint32_t>{0xFFFF'FFC0u, 58u, 58u}));
+  }
+}
+
+TEST(RxCapture, receive_captures_of_free_running_timer) {
+  NiceMock<BasicRxMock<Ticks80MHz>> mock;
+  std::array<uint8_t, 256uz> cvs{};
+  cvs[29uz - 1uz] = 0b10u;
+  cvs[1uz - 1uz] = 3u;
+  ON_CALL(mock, readCv(_)).WillByDefault([&](uint32_t cv_addr) {
+    return cv_addr < size(cvs) ? cvs[cv_addr] : 0u;
+  });
+  mock.init();
+
+  // Convert timings to timestamps of a free-running 16 bit timer
+  auto const timings{
+    dcc::tx::packet2timings<Ticks80MHz>(dcc::make_f0_f4_packet(3u, 0b1'0101u))};
+  std::vector<uint32_t> timestamps;
+  uint16_t timestamp{};
+  for (auto const t : timings)
+    timestamps.push_back(timestamp = static_cast<uint16_t>(timestamp + t));
+  timestamps.push_back(
+    static_cast<uint16_t>(timestamp + dcc::rx::Bit1 * 80u)); // Leave cutout
+
+  dcc::rx::Capture<uint16_t> capture;
+  capture(timestamps);
+  EXPECT_EQ(mock.receive(timestamps), size(timestamps) - 1uz);
+  mock.receive(timestamps.back());
+
+  EXPECT_CALL(mock, function(3u, 0b1'1111u, 0b1'0101u));
+  mock.execute();
+}
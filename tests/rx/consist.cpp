@@ -11,7 +11,7 @@ TEST_F(RxTest, consist_shall_not_act_on_cv_manipulation) {
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(cv_addr),
                       Matcher<uint8_t>(byte),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .Times(0);
   ReceiveAndExecuteTwice(
     dcc::make_cv_access_long_write_packet(_addrs.consist, cv_addr, byte));
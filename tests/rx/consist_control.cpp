@@ -1,14 +1,18 @@
 #include "rx_test.hpp"
 
 TEST_F(RxTest, consist_control) {
-  EXPECT_CALL(_mock, readCv(_)).BASIC_ADDRESS_READ_CV_INIT_SEQUENCE();
   auto cv19{RandomInterval<uint8_t>(0u, 255u)};
   auto packet{make_set_consist_address_packet(_addrs.primary, cv19)};
 
+  // Only CVs the consist address depends on are read again
+  EXPECT_CALL(_mock, readCv(_)).Times(0);
+  EXPECT_CALL(_mock, readCv(19u - 1u)).WillOnce(Return(cv19));
+  EXPECT_CALL(_mock, readCv(20u - 1u)).WillOnce(Return(_cvs[20uz - 1uz]));
+
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(19u - 1u),
                       Matcher<uint8_t>(cv19),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(cv19));
   if constexpr (DCC_STANDARD_COMPLIANCE) ReceiveAndExecute(packet);
   else ReceiveAndExecuteTwice(packet);
@@ -22,7 +26,7 @@ TEST_F(RxTest, consist_control_wrong_packet_length) {
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(19u - 1u),
                       Matcher<uint8_t>(cv19),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .Times(0);
   if constexpr (DCC_STANDARD_COMPLIANCE) ReceiveAndExecute(packet);
   else ReceiveAndExecuteTwice(packet);
@@ -35,7 +39,7 @@ TEST_F(RxTest, consist_control_wrong_encoding) {
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(19u - 1u),
                       Matcher<uint8_t>(_),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .Times(0);
   if constexpr (DCC_STANDARD_COMPLIANCE) ReceiveAndExecute(packet);
   else ReceiveAndExecuteTwice(packet);
@@ -35,7 +35,7 @@ TEST_F(RxTest, cv_access_long_verify_byte_operations_mode) {
   EXPECT_CALL(_mock,
               readCv(Matcher<uint32_t>(cv_addr),
                      Matcher<uint8_t>(_),
-                     Matcher<std::function<void(uint8_t)>>(_)))
+                     Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(RandomInterval<uint8_t>(0u, 255u)));
 
   ReceiveAndExecute(packet);
@@ -89,7 +89,7 @@ TEST_F(RxTest, cv_access_long_write_byte_operations_mode) {
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(cv_addr),
                       Matcher<uint8_t>(byte),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(byte));
   ReceiveAndExecuteTwice(
     make_cv_access_long_write_packet(_addrs.primary, cv_addr, byte));
@@ -105,7 +105,7 @@ TEST_F(
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(cv_addr),
                       Matcher<uint8_t>(byte),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(byte));
 
   ReceiveAndExecute(packet);
@@ -126,7 +126,7 @@ TEST_F(
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(cv_addr),
                       Matcher<uint8_t>(byte),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .Times(0);
 
   ReceiveAndExecute(packet);
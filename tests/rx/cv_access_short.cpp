@@ -5,12 +5,15 @@ TEST_F(RxTest, cv_access_short_cv17_18) {
                                     .type = dcc::Address::ExtendedLoco};
   encode_address(new_extended_address, &_cvs[17uz - 1uz]);
 
-  // Before switching basic address init sequence is invoked twice
+  // CV17 and CV18 each read CV29 and CV1, CV29 reads CV29, CV17, CV18, CV20
+  // and CV28
   EXPECT_CALL(_mock, readCv(_))
-    .BASIC_ADDRESS_READ_CV_INIT_SEQUENCE()
-    .BASIC_ADDRESS_READ_CV_INIT_SEQUENCE()
-    .EXTENDED_ADDRESS_READ_CV_INIT_SEQUENCE_CHANGE_CV29(_cvs[29uz - 1uz] |
-                                                        ztl::mask<5u>);
+    .Times(9)
+    .WillRepeatedly([this](uint32_t cv_addr) { return _cvs[cv_addr]; });
+  EXPECT_CALL(_mock, writeCv(29u - 1u, true, 5u)).WillOnce([this] {
+    _cvs[29uz - 1uz] = static_cast<uint8_t>(_cvs[29uz - 1uz] | ztl::mask<5u>);
+    return true;
+  });
 
   // Change address
   for (auto i{0uz}; i < 2uz; ++i)
@@ -31,7 +34,7 @@ TEST_F(RxTest, cv_access_short_cv23) {
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(23u - 1u),
                       Matcher<uint8_t>(cv23),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(cv23));
   if constexpr (DCC_STANDARD_COMPLIANCE) ReceiveAndExecute(packet);
   else ReceiveAndExecuteTwice(packet);
@@ -46,12 +49,12 @@ TEST_F(RxTest, cv_access_short_cv31_32) {
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(31u - 1u),
                       Matcher<uint8_t>(cv31),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(cv31));
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(32u - 1u),
                       Matcher<uint8_t>(cv32),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(cv32));
   ReceiveAndExecuteTwice(packet);
 }
@@ -103,3 +103,23 @@ TEST_F(RxTest, cv_access_xpom_write_bit) {
 
   ReceiveAndExecuteTwice(packet);
 }
+
+TEST_F(RxTest, cv_access_xpom_write_bytes_reconfigures_every_cv) {
+  EXPECT_CALL(_mock, readCv(_)).WillRepeatedly([this](uint32_t cv_addr) {
+    return _cvs[cv_addr];
+  });
+  EXPECT_CALL(_mock, writeCv(_, Matcher<uint8_t>(_)))
+    .WillRepeatedly(
+      [this](uint32_t cv_addr, uint8_t byte) { return _cvs[cv_addr] = byte; });
+
+  // Write starts at CV28 but also reverses direction in CV29
+  auto const cv28{_cvs[28uz - 1uz]};
+  auto const cv29{static_cast<uint8_t>(_cvs[29uz - 1uz] | ztl::mask<0u>)};
+  ReceiveAndExecuteTwice(make_cv_access_xpom_write_packet(
+    _addrs.primary, 0b00u, 28u - 1u, cv28, cv29));
+  EXPECT_EQ(_cvs[29uz - 1uz], cv29);
+
+  EXPECT_CALL(_mock, direction(_addrs.primary.value, dcc::Backward));
+  ReceiveAndExecute(
+    make_speed_and_direction_packet(_addrs.primary, 1u << 5u | 0b1010u));
+}
@@ -0,0 +1,104 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "rx_test.hpp"
+
+namespace {
+
+std::atomic<size_t> allocations{};
+
+} // namespace
+
+// Count every allocation of the test executable
+void* operator new(size_t size) {
+  allocations.fetch_add(1uz, std::memory_order_relaxed);
+  if (auto ptr{std::malloc(size ? size : 1uz)}) return ptr;
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+// Decoder which defers asynchronous CV access like a real flash backend
+struct AsyncDecoder : dcc::rx::CrtpBase<AsyncDecoder> {
+  AsyncDecoder() {
+    _cvs[29uz - 1uz] = 0b1010u;
+    _cvs[1uz - 1uz] = 3u;
+  }
+
+  // Complete pending CV access
+  bool complete() {
+    if (!_cb) return false;
+    std::invoke(std::exchange(_cb, {}), _cvs[_cv_addr]);
+    return true;
+  }
+
+  void direction(uint16_t, bool) {}
+  void speed(uint16_t, int32_t) {}
+  void function(uint16_t, uint32_t, uint32_t) {}
+  void serviceModeHook(bool) {}
+  void serviceAck() {}
+  void transmitBiDi(std::span<uint8_t const>) {}
+  void error() {}
+  uint8_t readCv(uint32_t cv_addr, uint8_t = 0u) { return _cvs[cv_addr]; }
+  uint8_t writeCv(uint32_t cv_addr, uint8_t byte) {
+    return _cvs[cv_addr] = byte;
+  }
+  bool readCv(uint32_t cv_addr, bool, uint32_t pos) {
+    return readCv(cv_addr) & (1u << pos);
+  }
+  bool writeCv(uint32_t, bool bit, uint32_t) { return bit; }
+  void readCv(uint32_t cv_addr, uint8_t, dcc::rx::CvCallback cb) {
+    _cv_addr = cv_addr;
+    _cb = cb;
+  }
+  void writeCv(uint32_t cv_addr, uint8_t byte, dcc::rx::CvCallback cb) {
+    _cvs[_cv_addr = cv_addr] = byte;
+    _cb = cb;
+  }
+
+private:
+  std::array<uint8_t, smath::pow(2uz, 16uz)> _cvs{};
+  uint32_t _cv_addr{};
+  dcc::rx::CvCallback _cb{};
+};
+
+static_assert(dcc::rx::AsyncReadable<AsyncDecoder>);
+static_assert(dcc::rx::AsyncWritable<AsyncDecoder>);
+
+} // namespace
+
+TEST(RxCvCallback, counting_operator_new_counts) {
+  auto const before{allocations.load()};
+  std::function<void(uint8_t)> f{[big = std::array<size_t, 8uz>{}](uint8_t) {
+    static_cast<void>(big);
+  }};
+  EXPECT_GT(allocations.load(), before);
+}
+
+TEST(RxCvCallback, async_cv_access_does_not_allocate) {
+  AsyncDecoder decoder;
+  decoder.init();
+
+  dcc::Address const addr{.value = 3u, .type = dcc::Address::BasicLoco};
+  std::array const timings{
+    dcc::tx::packet2timings(
+      dcc::make_cv_access_long_verify_packet(addr, 8u - 1u, 0u)),
+    dcc::tx::packet2timings(
+      dcc::make_cv_access_long_write_packet(addr, 3u - 1u, 42u))};
+
+  auto const before{allocations.load()};
+  auto completed{0uz};
+  for (auto const& packet : timings)
+    for (auto i{0uz}; i < 2uz; ++i) {
+      for (auto t : packet) decoder.receive(t);
+      decoder.receive(dcc::rx::Timing::Bit1);
+      decoder.execute();
+      completed += decoder.complete();
+    }
+  EXPECT_EQ(allocations.load(), before);
+  EXPECT_GE(completed, 2uz);
+}
@@ -0,0 +1,100 @@
+#include <dcc/rx/cv_journal.hpp>
+#include <dcc/rx/sim_flash.hpp>
+#include "rx_test.hpp"
+
+namespace {
+
+using Flash = dcc::rx::SimFlash<256uz, 2uz>;
+using Journal = dcc::rx::CvJournal<Flash, 128uz>;
+
+static_assert(dcc::rx::Readable<Journal>);
+static_assert(dcc::rx::Writable<Journal>);
+static_assert(dcc::rx::AsyncWritable<Journal>);
+
+struct RxCvJournalTest : ::testing::Test {
+  RxCvJournalTest() {
+    _defaults[1uz - 1uz] = 3u;
+    _defaults[29uz - 1uz] = 0b1010u;
+    _journal.load(_defaults);
+  }
+
+  Flash _flash;
+  Journal _journal{_flash};
+  std::array<uint8_t, 128uz> _defaults{};
+};
+
+} // namespace
+
+TEST_F(RxCvJournalTest, load_formats_erased_flash) {
+  EXPECT_EQ(_flash.counters().erases, 1uz);
+  EXPECT_EQ(_journal.readCv(1u - 1u), 3u);
+  EXPECT_EQ(_journal.readCv(29u - 1u), 0b1010u);
+  EXPECT_FALSE(_journal.dirty());
+}
+
+TEST_F(RxCvJournalTest, writes_are_deferred_until_flush) {
+  auto const programs{_flash.counters().programs};
+  EXPECT_EQ(_journal.writeCv(8u - 1u, 42u), 42u);
+  EXPECT_TRUE(_journal.writeCv(29u - 1u, true, 5u));
+  uint8_t written{};
+  _journal.writeCv(
+    17u - 1u, 0xC4u, [&written](uint8_t byte) { written = byte; });
+  EXPECT_EQ(written, 0xC4u);
+  EXPECT_EQ(_flash.counters().programs, programs);
+  EXPECT_TRUE(_journal.dirty());
+
+  // All dirty CVs in a single program call
+  _journal.flush();
+  EXPECT_EQ(_flash.counters().programs, programs + 1uz);
+  EXPECT_FALSE(_journal.dirty());
+
+  Journal journal{_flash};
+  journal.load(_defaults);
+  EXPECT_EQ(journal.readCv(8u - 1u), 42u);
+  EXPECT_EQ(journal.readCv(29u - 1u), 0b10'1010u);
+  EXPECT_EQ(journal.readCv(17u - 1u), 0xC4u);
+}
+
+TEST_F(RxCvJournalTest, unchanged_writes_are_not_dirty) {
+  _journal.writeCv(1u - 1u, 3u);
+  EXPECT_FALSE(_journal.dirty());
+}
+
+TEST_F(RxCvJournalTest, full_sector_gets_compacted_into_other_sector) {
+  // 256 - 4 - 128 bytes leave space for 31 records
+  for (auto i{0u}; i < 100u; ++i) {
+    _journal.writeCv(8u - 1u, static_cast<uint8_t>(i));
+    _journal.flush();
+  }
+  EXPECT_EQ(_flash.counters().wear[0uz], 2uz);
+  EXPECT_EQ(_flash.counters().wear[1uz], 2uz);
+
+  Journal journal{_flash};
+  journal.load(_defaults);
+  EXPECT_EQ(journal.readCv(8u - 1u), 99u);
+  EXPECT_EQ(journal.readCv(1u - 1u), 3u);
+}
+
+TEST_F(RxCvJournalTest, torn_record_is_ignored) {
+  _journal.writeCv(8u - 1u, 1u);
+  _journal.flush();
+  _journal.writeCv(8u - 1u, 2u);
+  _journal.flush();
+
+  // Power-fail while programming the second record
+  _flash.memory()[4uz + 128uz + 4uz + 3uz] = 0xFFu;
+
+  Journal journal{_flash};
+  journal.load(_defaults);
+  EXPECT_EQ(journal.readCv(8u - 1u), 1u);
+
+  // Writes after the tear must survive
+  journal.writeCv(8u - 1u, 3u);
+  journal.writeCv(9u - 1u, 4u);
+  journal.flush();
+
+  Journal reloaded{_flash};
+  reloaded.load(_defaults);
+  EXPECT_EQ(reloaded.readCv(8u - 1u), 3u);
+  EXPECT_EQ(reloaded.readCv(9u - 1u), 4u);
+}
@@ -0,0 +1,70 @@
+#include <dcc/rx/cv_store.hpp>
+#include "rx_test.hpp"
+
+static_assert(dcc::rx::Readable<dcc::rx::CvStore<4uz>>);
+static_assert(dcc::rx::Writable<dcc::rx::CvStore<4uz>>);
+
+TEST(RxCvStore, unwritten_cvs_read_zero_without_allocation) {
+  dcc::rx::CvStore<4uz> cvs;
+  EXPECT_EQ(cvs.readCv(8u - 1u), 0u);
+  EXPECT_EQ(cvs.writeCv(0xAB'CDEFu, 0u), 0u);
+  EXPECT_EQ(cvs.usage().pages, 0uz);
+  EXPECT_EQ(cvs.usage().tables, 0uz);
+}
+
+TEST(RxCvStore, full_24_bit_address_space) {
+  dcc::rx::CvStore<4uz> cvs;
+  EXPECT_EQ(cvs.writeCv(1u - 1u, 3u), 3u);
+  EXPECT_EQ(cvs.writeCv(0xFF'FFFFu, 42u), 42u);
+  EXPECT_EQ(cvs.writeCv(0xFF'FF00u, 43u), 43u);
+  EXPECT_EQ(cvs.readCv(1u - 1u), 3u);
+  EXPECT_EQ(cvs.readCv(0xFF'FFFFu), 42u);
+  EXPECT_EQ(cvs.readCv(0xFF'FF00u), 43u);
+  EXPECT_EQ(cvs.readCv(0xFE'FFFFu), 0u);
+
+  auto const usage{cvs.usage()};
+  EXPECT_EQ(usage.pages, 2uz);
+  EXPECT_EQ(usage.max_pages, 4uz);
+  EXPECT_EQ(usage.tables, 2uz);
+  EXPECT_EQ(usage.bytes, sizeof(cvs));
+}
+
+TEST(RxCvStore, indexed_cvs_map_to_cv31_cv32) {
+  dcc::rx::CvStore<4uz> cvs;
+
+  // RailCom block
+  cvs.writeCv(31u - 1u, 0u);
+  cvs.writeCv(32u - 1u, 255u);
+  cvs.writeCv(257u + 16u - 1u, 0xABu);
+  EXPECT_EQ(cvs.readCv(DCC_RX_LOGON_CID_CV_ADDRESS), 0xABu);
+
+  // Other page, same index
+  cvs.writeCv(31u - 1u, 16u);
+  EXPECT_EQ(cvs.readCv(257u + 16u - 1u), 0u);
+  cvs.writeCv(257u + 16u - 1u, 0xCDu);
+  EXPECT_EQ(cvs.readCv(0x10'FF10u), 0xCDu);
+  EXPECT_EQ(cvs.readCv(DCC_RX_LOGON_CID_CV_ADDRESS), 0xABu);
+}
+
+TEST(RxCvStore, exhausted_arena_fails_writes) {
+  dcc::rx::CvStore<2uz, 1uz> cvs;
+  EXPECT_EQ(cvs.writeCv(0x00'0100u, 1u), 1u);
+  EXPECT_EQ(cvs.writeCv(0x00'0200u, 2u), 2u);
+  ASSERT_DEBUG_DEATH(cvs.writeCv(0x00'0300u, 3u), ".*");
+  ASSERT_DEBUG_DEATH(cvs.writeCv(0x01'0000u, 4u), ".*");
+#if defined(NDEBUG)
+  // Read back differs from written value, so verify fails
+  EXPECT_EQ(cvs.writeCv(0x00'0300u, 3u), 0u);
+  EXPECT_EQ(cvs.writeCv(0x01'0000u, 4u), 0u);
+  EXPECT_FALSE(cvs.writeCv(0x00'0300u, true, 0u));
+#endif
+  EXPECT_EQ(cvs.readCv(0x00'0300u), 0u);
+  EXPECT_EQ(cvs.readCv(0x01'0000u), 0u);
+  EXPECT_EQ(cvs.readCv(0x00'0100u), 1u);
+  EXPECT_EQ(cvs.readCv(0x00'0200u), 2u);
+  EXPECT_EQ(cvs.usage().pages, 2uz);
+
+  // Writing zeros never needs a page
+  EXPECT_EQ(cvs.writeCv(0x00'0300u, 0u), 0u);
+  EXPECT_EQ(cvs.usage().pages, 2uz);
+}
@@ -10,7 +10,7 @@ TEST_F(RxTest, cv15_not_equal_cv15_activates_decoder_lock) {
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(cv_addr),
                       Matcher<uint8_t>(byte),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .Times(0);
   ReceiveAndExecuteTwice(
     dcc::make_cv_access_long_write_packet(_addrs.primary, cv_addr, byte));
@@ -26,7 +26,7 @@ TEST_F(RxTest, cv15_zero_deactivates_decoder_lock) {
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(cv_addr),
                       Matcher<uint8_t>(byte),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(byte));
   ReceiveAndExecuteTwice(
     dcc::make_cv_access_long_write_packet(_addrs.primary, cv_addr, byte));
@@ -42,7 +42,7 @@ TEST_F(RxTest, cv16_zero_deactivates_decoder_lock) {
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(cv_addr),
                       Matcher<uint8_t>(byte),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(byte));
   ReceiveAndExecuteTwice(
     dcc::make_cv_access_long_write_packet(_addrs.primary, cv_addr, byte));
@@ -28,3 +28,17 @@ TEST_F(RxTest, feature_expansion_f28_f21) {
                        static_cast<uint32_t>(state) << 21u));
   ReceiveAndExecute(make_f21_f28_packet(_addrs.primary, state));
 }
+
+TEST_F(RxTest, feature_expansion_f36_f29_only_f31_f29_fit_into_32_bits) {
+  auto state{RandomInterval<uint8_t>(0x00u, 0xFFu)};
+  EXPECT_CALL(_mock,
+              function(_addrs.primary.value,
+                       0b111u << 29u,
+                       static_cast<uint32_t>(state & 0b111u) << 29u));
+  ReceiveAndExecute(make_f29_f36_packet(_addrs.primary, state));
+}
+
+TEST_F(RxTest, feature_expansion_f44_f37_dont_fit_into_32_bits) {
+  EXPECT_CALL(_mock, function(_, _, _)).Times(0);
+  ReceiveAndExecute(make_f37_f44_packet(_addrs.primary, 0xFFu));
+}
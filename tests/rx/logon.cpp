@@ -202,3 +202,124 @@ TEST_F(RxTest, transmitting_decoder_unique_more_than_3_times_triggers_error) {
     ReceiveAndExecute(make_logon_enable_packet(
       dcc::LogonGroup::Now, _cid + 1u, RandomInterval<uint8_t>(0u, 255u)));
 }
+
+TEST_F(RxTest, short_info_follows_permanent_assign) {
+  EXPECT_CALL(_mock, transmitBiDi(_)).Times(AnyNumber());
+
+  // Enable, select and permanently assign address 42
+  Receive(make_logon_enable_packet(
+    dcc::LogonGroup::Now, _cid + 1u, RandomInterval<uint8_t>(0u, 255u)));
+  BiDi();
+  Receive(dcc::make_logon_select_packet(DCC_MANUFACTURER_ID, _did));
+  BiDi();
+  _addrs.logon = {.value = 42u, .type = dcc::Address::BasicLoco};
+  Receive(make_logon_assign_packet(DCC_MANUFACTURER_ID,
+                                   _did,
+                                   _addrs.logon,
+                                   dcc::LogonBindingBehavior::Permanent));
+  BiDi();
+  ReceiveAndExecute(dcc::make_128_speed_step_control_packet(_addrs.logon, 0u));
+
+  // Unknown CID forces new logon
+  Receive(make_logon_enable_packet(dcc::LogonGroup::Now, _cid + 2u, _sid));
+  BiDi();
+
+  // ShortInfo contains new primary address
+  std::array<uint8_t, 5uz> short_info{0x80u, 0u, 63u, 0x40u, 0u};
+  dcc::encode_logon_address(_addrs.logon, begin(short_info) + 1);
+  auto const datagram{
+    dcc::bidi::encode_datagram(dcc::bidi::make_datagram<dcc::bidi::Bits::_48>(
+      static_cast<uint64_t>(short_info[0uz]) << 40u |
+      static_cast<uint64_t>(short_info[1uz]) << 32u |
+      static_cast<uint32_t>(short_info[2uz]) << 24u |
+      static_cast<uint32_t>(short_info[3uz]) << 16u |
+      static_cast<uint32_t>(short_info[4uz]) << 8u | dcc::crc8(short_info)))};
+  EXPECT_CALL(_mock,
+              transmitBiDi(DatagramMatcher(
+                std::span{cbegin(datagram) + 2, cend(datagram)})))
+    .Times(1);
+  Receive(dcc::make_logon_select_packet(DCC_MANUFACTURER_ID, _did));
+  BiDi();
+}
+
+namespace {
+
+// Generator which always returns the minimum, so backoffs never back off
+struct Min {
+  using result_type = uint32_t;
+  static constexpr result_type min() { return 0u; }
+  static constexpr result_type max() { return 255u; }
+  constexpr result_type operator()() { return min(); }
+};
+
+// Mock with its own random number generator
+struct MinRxMock : dcc::rx::CrtpBase<MinRxMock, std::micro, Min>,
+                   RxMockMethods {};
+
+// Rounds of LOGON_ENABLE(All) in which a decoder with given ID answers
+template<typename Mock = RxMock>
+std::vector<size_t> LogonEnableAnswers(uint32_t did, size_t rounds) {
+  std::array<uint8_t, smath::pow(2uz, 16uz)> cvs{};
+  cvs[29uz - 1uz] = 0b1010u;
+  cvs[1uz - 1uz] = 3u;
+  cvs[28uz - 1uz] = 0b1000'0011u;
+  for (auto i{0uz}; i < sizeof(did); ++i)
+    cvs[DCC_RX_LOGON_DID_CV_ADDRESS + i] =
+      static_cast<uint8_t>(did >> (24uz - i * 8uz));
+
+  NiceMock<Mock> mock;
+  ON_CALL(mock, readCv(_)).WillByDefault([&cvs](uint32_t cv_addr) {
+    return cvs[cv_addr];
+  });
+  mock.init();
+  bool answered{};
+  ON_CALL(mock, transmitBiDi(_)).WillByDefault([&answered] {
+    answered = true;
+  });
+
+  // Decoder gives up after 3 answers
+  std::vector<size_t> answers;
+  auto const packet{
+    dcc::make_logon_enable_packet(dcc::LogonGroup::All, 0xABCDu, 0x2Au)};
+  for (auto i{0uz}; i < rounds && size(answers) < 3uz; ++i) {
+    answered = false;
+    for (auto t : dcc::tx::packet2timings(packet)) mock.receive(t);
+    mock.biDiChannel1();
+    mock.biDiChannel2();
+    mock.receive(dcc::rx::Timing::Bit1);
+    mock.execute();
+    if (answered) answers.push_back(i);
+  }
+  return answers;
+}
+
+} // namespace
+
+TEST(RxLogonBackoff, different_dids_diverge) {
+  auto const a{LogonEnableAnswers(0xAABBCCDDu, 64uz)};
+  auto const b{LogonEnableAnswers(0xAABBCCDEu, 64uz)};
+  EXPECT_EQ(size(a), 3uz);
+  EXPECT_EQ(size(b), 3uz);
+  EXPECT_NE(a, b);
+
+  // Same ID, same rounds
+  EXPECT_EQ(LogonEnableAnswers(0xAABBCCDDu, 64uz), a);
+}
+
+TEST(RxLogonBackoff, did_0_falls_back_to_default_seed) {
+  static_assert(dcc::rx::Xorshift32{0u}() ==
+                dcc::rx::Xorshift32{dcc::rx::Xorshift32::default_seed}());
+
+  // Decoder answers whenever a backoff with the default seed doesn't back off
+  dcc::rx::Backoff backoff{
+    dcc::rx::Xorshift32{dcc::rx::Xorshift32::default_seed}};
+  std::vector<size_t> expected;
+  for (auto i{0uz}; size(expected) < 3uz; ++i)
+    if (!backoff) expected.push_back(i);
+  EXPECT_EQ(LogonEnableAnswers(0u, 64uz), expected);
+}
+
+TEST(RxLogonBackoff, injectable_generator) {
+  EXPECT_EQ(LogonEnableAnswers<MinRxMock>(0xAABBCCDDu, 64uz),
+            (std::vector{0uz, 1uz, 2uz}));
+}
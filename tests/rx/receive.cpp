@@ -52,19 +52,171 @@ TEST_F(RxTest, writing_cv1_clears_cv29_5) {
   _cvs[29uz - 1uz] = _cvs[29uz - 1uz] | ztl::mask<5u>;
   SetUp();
 
-  EXPECT_CALL(_mock, readCv(_))
-    .BASIC_ADDRESS_READ_CV_INIT_SEQUENCE_CHANGE_CV29(
-      static_cast<uint8_t>(_cvs[29uz - 1uz] & ~ztl::mask<5u>));
-
   // Write CV1=3 (which clears CV29:5)
   uint8_t cv_addr{1u - 1u};
   uint8_t byte{3u};
+  EXPECT_CALL(_mock, readCv(29u - 1u))
+    .WillOnce(
+      Return(static_cast<uint8_t>(_cvs[29uz - 1uz] & ~ztl::mask<5u>)));
+  EXPECT_CALL(_mock, readCv(1u - 1u)).WillOnce(Return(byte));
   EXPECT_CALL(_mock,
               writeCv(Matcher<uint32_t>(cv_addr),
                       Matcher<uint8_t>(byte),
-                      Matcher<std::function<void(uint8_t)>>(_)))
+                      Matcher<dcc::rx::CvCallback>(_)))
     .WillOnce(InvokeArgument<2uz>(byte));
   EXPECT_CALL(_mock, writeCv(29u - 1u, false, 5u)).WillOnce(Return(false));
   ReceiveAndExecuteTwice(
     make_cv_access_long_write_packet(_addrs.primary, cv_addr, byte));
 }
+
+TEST_F(RxTest, receive_buffer_stops_after_packet_end) {
+  std::vector<uint32_t> times;
+  for (auto const& packet : {make_f0_f4_packet(_addrs.primary, 0b1'0101u),
+                             make_f9_f12_packet(_addrs.primary, 0b1010u)}) {
+    auto const timings{dcc::tx::packet2timings(packet)};
+    times.insert(cend(times), cbegin(timings), cend(timings));
+  }
+  times.push_back(dcc::rx::Timing::Bit1);
+  std::span<uint32_t const> buffer{times};
+
+  // First packet ends in the middle of the buffer
+  auto const first_size{size(dcc::tx::packet2timings(
+    make_f0_f4_packet(_addrs.primary, 0b1'0101u)))};
+  EXPECT_EQ(_mock.receive(buffer), first_size);
+  EXPECT_TRUE(_mock.packetEnd());
+  buffer = buffer.subspan(first_size);
+
+  // Second packet ends one time before end of buffer
+  EXPECT_EQ(_mock.receive(buffer), size(buffer) - 1uz);
+  EXPECT_TRUE(_mock.packetEnd());
+  buffer = buffer.subspan(size(buffer) - 1uz);
+
+  // Leave cutout
+  EXPECT_EQ(_mock.receive(buffer), 1uz);
+  EXPECT_FALSE(_mock.packetEnd());
+
+  EXPECT_CALL(_mock, function(_addrs.primary.value, 0b1'1111u, 0b1'0101u));
+  EXPECT_CALL(_mock, function(_addrs.primary.value, 0xFu << 9u, 0b1010u << 9u));
+  Execute()->Execute();
+}
+
+TEST_F(RxTest, foreign_packets_dont_fill_deque) {
+  // Many more foreign packets than fit into the deque
+  for (auto i{0uz}; i < DCC_RX_DEQUE_SIZE * 2uz; ++i) {
+    Receive(dcc::make_f0_f4_packet(42u, 0b1'1111u));
+    Receive(dcc::make_f0_f4_packet(
+      {.value = 2000u, .type = dcc::Address::ExtendedLoco}, 0b1'1111u));
+    Receive(dcc::make_f0_f4_packet(
+      {.value = _addrs.primary, .type = dcc::Address::ExtendedLoco},
+      0b1'1111u));
+  }
+  Receive(make_f0_f4_packet(_addrs.primary, 0b1'0101u))->LeaveCutout();
+
+  // Own packet is first in line
+  EXPECT_CALL(_mock, function(_, _, _)).Times(0);
+  EXPECT_CALL(_mock, function(_addrs.primary.value, 0b1'1111u, 0b1'0101u));
+  while (_mock.execute());
+}
+
+TEST_F(RxTest, service_mode_packets_following_reset_are_not_filtered) {
+  auto cv_addr{RandomInterval(0u, smath::pow(2u, 10u) - 1u)};
+  auto packet{dcc::make_cv_access_long_verify_service_packet(cv_addr, 42u)};
+
+  // Receive everything before executing
+  for (auto i{0uz}; i < 3uz; ++i) Receive(dcc::make_reset_packet());
+  for (auto i{0uz}; i < 5uz; ++i) Receive(packet);
+  LeaveCutout();
+
+  EXPECT_CALL(_mock, serviceModeHook(true));
+  EXPECT_CALL(_mock, readCv(cv_addr, 42u)).WillOnce(Return(42u));
+  EXPECT_CALL(_mock, serviceAck());
+  while (_mock.execute());
+}
+
+TEST_F(RxTest, superseded_state_packets_are_skipped) {
+  // Execution falls behind
+  for (auto speed : {10u, 20u, 30u}) {
+    Receive(make_128_speed_step_control_packet(
+      _addrs.primary, static_cast<uint8_t>(dcc::Forward << 7u | speed)));
+    Receive(make_f0_f4_packet(_addrs.primary, static_cast<uint8_t>(speed)));
+  }
+  LeaveCutout();
+
+  // Only the latest state gets executed if coalescing is enabled
+  EXPECT_CALL(_mock, direction(_addrs.primary.value, dcc::Forward))
+    .Times(DCC_RX_COALESCE_PACKETS ? 1 : 3);
+  for (auto speed : {10u, 20u, 30u}) {
+    auto const times{DCC_RX_COALESCE_PACKETS && speed != 30u ? 0 : 1};
+    EXPECT_CALL(_mock,
+                speed(_addrs.primary.value,
+                      dcc::scale_speed<126>(static_cast<int32_t>(speed) - 1)))
+      .Times(times);
+    EXPECT_CALL(_mock,
+                function(_addrs.primary.value, 0b1'1111u, speed & 0b1'1111u))
+      .Times(times);
+  }
+  while (_mock.execute());
+}
+
+TEST_F(RxTest, skipped_state_packets_still_separate_cv_access_packets) {
+  auto const pom{
+    make_cv_access_long_write_packet(_addrs.primary, 42u - 1u, 42u)};
+  Receive(pom);
+  Receive(make_128_speed_step_control_packet(_addrs.primary, 10u));
+  Receive(pom);
+  Receive(make_128_speed_step_control_packet(_addrs.primary, 20u));
+  LeaveCutout();
+
+  // Two write packets must follow each other immediately
+  EXPECT_CALL(_mock, writeCv(_, Matcher<uint8_t>(_))).Times(0);
+  EXPECT_CALL(_mock, writeCv(_, Matcher<uint8_t>(_), _)).Times(0);
+  while (_mock.execute());
+}
+
+TEST_F(RxTest, execute_with_budget_drains_backlog) {
+  // Different function groups, so that none of them get skipped
+  Receive(make_f0_f4_packet(_addrs.primary, 0b1'0001u));
+  Receive(make_f5_f8_packet(_addrs.primary, 0b0001u));
+  Receive(make_f9_f12_packet(_addrs.primary, 0b0001u));
+  Receive(make_f13_f20_packet(_addrs.primary, 0b0000'0001u));
+  Receive(make_f21_f28_packet(_addrs.primary, 0b0000'0001u));
+  LeaveCutout();
+
+  {
+    InSequence s;
+    EXPECT_CALL(_mock, function(_addrs.primary.value, 0b1'1111u, 0b1'0001u));
+    EXPECT_CALL(_mock, function(_addrs.primary.value, 0xFu << 5u, 1u << 5u));
+    EXPECT_CALL(_mock, function(_addrs.primary.value, 0xFu << 9u, 1u << 9u));
+    EXPECT_CALL(_mock,
+                function(_addrs.primary.value, 0xFFu << 13u, 1u << 13u));
+    EXPECT_CALL(_mock,
+                function(_addrs.primary.value, 0xFFu << 21u, 1u << 21u));
+  }
+  EXPECT_EQ(_mock.execute(3uz), 3uz);
+  EXPECT_EQ(_mock.execute(10uz), 2uz);
+  EXPECT_EQ(_mock.execute(10uz), 0uz);
+}
+
+TEST_F(RxTest, execute_until_deadline_drains_backlog) {
+  // Different function groups, so that none of them get skipped
+  Receive(make_f0_f4_packet(_addrs.primary, 0b1'0001u));
+  Receive(make_f5_f8_packet(_addrs.primary, 0b0001u));
+  Receive(make_f9_f12_packet(_addrs.primary, 0b0001u));
+  Receive(make_f13_f20_packet(_addrs.primary, 0b0000'0001u));
+  Receive(make_f21_f28_packet(_addrs.primary, 0b0000'0001u));
+  LeaveCutout();
+
+  // Deadline already passed
+  EXPECT_EQ(_mock.execute(std::chrono::steady_clock::now() -
+                          std::chrono::milliseconds{1}),
+            0uz);
+
+  EXPECT_CALL(_mock, function(_addrs.primary.value, _, _)).Times(5);
+  EXPECT_EQ(_mock.execute(std::chrono::steady_clock::time_point::max()), 5uz);
+}
+
+TEST_F(RxTest, execute_with_budget_stops_at_packet_end) {
+  Receive(make_f0_f4_packet(_addrs.primary, 0b1'0101u));
+  EXPECT_CALL(_mock, function(_, _, _)).Times(0);
+  EXPECT_EQ(_mock.execute(10uz), 0uz);
+}
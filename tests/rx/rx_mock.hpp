@@ -4,7 +4,11 @@
 #include <gtest/gtest.h>
 #include <dcc/dcc.hpp>
 
-struct RxMock : dcc::rx::CrtpBase<RxMock> {
+// Methods every receive mock needs
+//
+// Mocks with optional concepts derive from dcc::rx::CrtpBase and this and only
+// add the methods of those concepts.
+struct RxMockMethods {
   MOCK_METHOD(void, direction, (uint16_t, int32_t), ());
   MOCK_METHOD(void, speed, (uint16_t, int32_t), ());
   MOCK_METHOD(void, function, (uint16_t, uint32_t, uint32_t), ());
@@ -17,13 +21,17 @@ struct RxMock : dcc::rx::CrtpBase<RxMock> {
   MOCK_METHOD(uint8_t, writeCv, (uint32_t, uint8_t), ());
   MOCK_METHOD(bool, readCv, (uint32_t, bool, uint32_t), ());
   MOCK_METHOD(bool, writeCv, (uint32_t, bool, uint32_t), ());
-  MOCK_METHOD(void,
-              readCv,
-              (uint32_t, uint8_t, std::function<void(uint8_t)>),
-              ());
-  MOCK_METHOD(void,
-              writeCv,
-              (uint32_t, uint8_t, std::function<void(uint8_t)>),
-              ());
+  MOCK_METHOD(void, readCv, (uint32_t, uint8_t, dcc::rx::CvCallback), ());
+  MOCK_METHOD(void, writeCv, (uint32_t, uint8_t, dcc::rx::CvCallback), ());
   MOCK_METHOD(void, eastWestDirection, (uint16_t, std::optional<int32_t>), ());
+
+  // Monotonic clock, advanced by tests instead of sleeping
+  uint32_t now() const { return _now; }
+  uint32_t _now{};
 };
+
+template<typename Period = std::micro>
+struct BasicRxMock : dcc::rx::CrtpBase<BasicRxMock<Period>, Period>,
+                     RxMockMethods {};
+
+using RxMock = BasicRxMock<>;
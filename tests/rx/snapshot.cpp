@@ -0,0 +1,74 @@
+#include "rx_test.hpp"
+
+TEST_F(RxTest, init_from_snapshot_reads_no_cvs) {
+  auto const snapshot{_mock.snapshot(1u)};
+  EXPECT_EQ(snapshot.crc, dcc::rx::checksum(snapshot));
+  EXPECT_EQ(snapshot.primary, _addrs.primary);
+  EXPECT_EQ(snapshot.logon, _addrs.logon);
+
+  EXPECT_CALL(_mock, readCv(_)).Times(0);
+  EXPECT_TRUE(_mock.init(snapshot, 1u));
+
+  auto state{RandomInterval<uint8_t>(0b0'0000u, 0b1'1111u)};
+  EXPECT_CALL(_mock, function(_addrs.primary.value, 0b1'1111u, state));
+  ReceiveAndExecute(make_f0_f4_packet(_addrs.primary, state));
+}
+
+TEST_F(RxTest, init_from_corrupted_snapshot_reads_cvs) {
+  auto snapshot{_mock.snapshot(1u)};
+  snapshot.primary.value = 42u;
+  EXPECT_CALL(_mock, readCv(_)).BASIC_ADDRESS_READ_CV_INIT_SEQUENCE();
+  EXPECT_FALSE(_mock.init(snapshot, 1u));
+  EXPECT_EQ(_mock.snapshot(1u).primary, _addrs.primary);
+}
+
+TEST_F(RxTest, cv_write_outdates_snapshot) {
+  auto const snapshot{_mock.snapshot(1u)};
+  EXPECT_FALSE(_mock.snapshotOutdated(snapshot));
+
+  // Disable logon
+  _cvs[28uz - 1uz] = 0b0000'0011u;
+  EXPECT_CALL(_mock, readCv(_)).WillRepeatedly([this](uint32_t cv_addr) {
+    return _cvs[cv_addr];
+  });
+  EXPECT_CALL(_mock,
+              writeCv(Matcher<uint32_t>(28u - 1u),
+                      Matcher<uint8_t>(_cvs[28uz - 1uz]),
+                      Matcher<dcc::rx::CvCallback>(_)))
+    .WillOnce(InvokeArgument<2uz>(_cvs[28uz - 1uz]));
+  ReceiveAndExecuteTwice(make_cv_access_long_write_packet(
+    _addrs.primary, 28u - 1u, _cvs[28uz - 1uz]));
+  EXPECT_TRUE(_mock.snapshotOutdated(snapshot));
+
+  // Retaken snapshot is up to date again
+  auto const retaken{_mock.snapshot(2u)};
+  EXPECT_EQ(retaken.flags & dcc::rx::Snapshot::LogonEnabled, 0u);
+  EXPECT_FALSE(_mock.snapshotOutdated(retaken));
+}
+
+TEST_F(RxTest, init_from_snapshot_after_power_cycle) {
+  auto const snapshot{_mock.snapshot(1u)};
+  NiceMock<RxMock> mock;
+  EXPECT_CALL(mock, readCv(_)).Times(0);
+  EXPECT_TRUE(mock.init(snapshot, 1u));
+  EXPECT_FALSE(mock.snapshotOutdated(snapshot));
+  EXPECT_EQ(mock.snapshot(1u).primary, _addrs.primary);
+}
+
+TEST_F(RxTest, init_from_snapshot_after_power_cycle_and_cv_write_reads_cvs) {
+  auto const snapshot{_mock.snapshot(1u)};
+
+  // Primary address got written, but power was lost before the snapshot got
+  // retaken
+  _cvs[1uz - 1uz] = 42u;
+  NiceMock<RxMock> mock;
+  EXPECT_CALL(mock, readCv(_)).BASIC_ADDRESS_READ_CV_INIT_SEQUENCE();
+  EXPECT_FALSE(mock.init(snapshot, 2u));
+  EXPECT_EQ(mock.snapshot(2u).primary.value, 42u);
+  EXPECT_TRUE(mock.snapshotOutdated(snapshot));
+}
+
+TEST(RxSnapshot, zeros_are_invalid) {
+  dcc::rx::Snapshot snapshot{};
+  EXPECT_NE(snapshot.crc, dcc::rx::checksum(snapshot));
+}
@@ -0,0 +1,98 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "rx_test.hpp"
+
+TEST(RxSpscQueue, push_back_until_full) {
+  dcc::rx::SpscQueue<int, 3uz> queue;
+  EXPECT_TRUE(empty(queue));
+  for (auto i{0}; i < 3; ++i) EXPECT_TRUE(queue.push_back(i));
+  EXPECT_TRUE(full(queue));
+  EXPECT_FALSE(queue.push_back(3));
+  EXPECT_EQ(size(queue), 3uz);
+  EXPECT_EQ(queue.front(), 0);
+  queue.clear();
+  EXPECT_TRUE(empty(queue));
+}
+
+TEST(RxSpscQueue, indices_wrap_around) {
+  dcc::rx::SpscQueue<int, 3uz> queue;
+  for (auto i{0}; i < 100; ++i) {
+    EXPECT_TRUE(queue.push_back(i));
+    if (size(queue) < 2uz) continue;
+    EXPECT_EQ(queue.front(), i - 1);
+    queue.pop_front();
+  }
+  EXPECT_EQ(size(queue), 1uz);
+  EXPECT_EQ(queue.front(), 99);
+}
+
+TEST(RxSpscQueue, prepared_slot_is_invisible_while_full) {
+  dcc::rx::SpscQueue<int, 2uz> queue;
+  queue.prepare() = 0;
+  EXPECT_TRUE(queue.commit());
+  queue.prepare() = 1;
+  EXPECT_TRUE(queue.commit());
+
+  // Assembling into the prepared slot of a full queue doesn't touch elements
+  queue.prepare() = 2;
+  EXPECT_FALSE(queue.commit());
+  EXPECT_EQ(queue.front(), 0);
+  queue.pop_front();
+  EXPECT_EQ(queue.front(), 1);
+  queue.pop_front();
+  EXPECT_TRUE(empty(queue));
+
+  queue.prepare() = 3;
+  EXPECT_TRUE(queue.commit());
+  EXPECT_EQ(queue.front(), 3);
+}
+
+// Meant to be run with -DDCC_SANITIZE_THREAD=ON
+TEST_F(RxTest, receive_and_execute_from_different_threads) {
+  static constexpr auto n{10'000uz};
+  std::vector<size_t> skipped;
+  skipped.reserve(n);
+  std::atomic<size_t> executed{}; // Index of last executed packet + 1
+  EXPECT_CALL(_mock, function(_addrs.primary.value, 0xFFu << 13u, _))
+    .WillRepeatedly([&](uint16_t, uint32_t, uint32_t state) {
+      // Packets are numbered modulo 256 but far less than that are in flight
+      auto const i{executed.load(std::memory_order_relaxed)};
+      auto const gap{static_cast<uint8_t>((state >> 13u) - i)};
+      skipped.push_back(gap);
+      executed.store(i + gap + 1uz, std::memory_order_release);
+    });
+
+  // Handler mode
+  std::jthread producer{[&] {
+    for (auto i{0uz}; i < n; ++i) {
+      // Dropping packets on a full queue isn't subject of this test
+      while (i - executed.load(std::memory_order_acquire) >=
+             DCC_RX_DEQUE_SIZE - 1uz)
+        std::this_thread::yield();
+      for (auto t : dcc::tx::packet2timings(
+             dcc::make_f13_f20_packet(42u, static_cast<uint8_t>(i))))
+        _mock.receive(t);
+      for (auto t : dcc::tx::packet2timings(
+             make_f13_f20_packet(_addrs.primary, static_cast<uint8_t>(i))))
+        _mock.receive(t);
+      // Leave cutout, thread mode doesn't execute while at packet end
+      _mock.receive(dcc::rx::Timing::Bit1);
+    }
+  }};
+
+  // Thread mode
+  while (executed.load(std::memory_order_acquire) < n) _mock.execute();
+  producer.join();
+
+  ASSERT_EQ(executed.load(), n);
+
+  // Coalescing may skip packets superseded by a queued one
+  for (auto gap : skipped) {
+    if constexpr (DCC_RX_COALESCE_PACKETS) {
+      EXPECT_LT(gap, DCC_RX_DEQUE_SIZE);
+    } else {
+      EXPECT_EQ(gap, 0uz);
+    }
+  }
+}
@@ -0,0 +1,52 @@
+#include "rx_test.hpp"
+
+TEST_F(RxTest, unchanged_callbacks_delivered_by_default) {
+  auto const packet{make_f0_f4_packet(_addrs.primary, 0b1'0101u)};
+  EXPECT_CALL(_mock, function(_addrs.primary.value, 0b1'1111u, 0b1'0101u))
+    .Times(2);
+  ReceiveAndExecute(packet);
+  ReceiveAndExecute(packet);
+  EXPECT_EQ(_mock.callbackCounts().delivered, 2uz);
+  EXPECT_EQ(_mock.callbackCounts().suppressed, 0uz);
+}
+
+TEST_F(RxTest, suppress_unchanged_speed_and_direction) {
+  _mock.suppressUnchanged(true);
+  EXPECT_CALL(_mock, direction(_addrs.primary.value, dcc::Forward));
+  EXPECT_CALL(_mock, speed(_addrs.primary.value, dcc::scale_speed<126>(41)));
+  EXPECT_CALL(_mock, speed(_addrs.primary.value, dcc::scale_speed<126>(42)));
+  for (auto i{0uz}; i < 3uz; ++i)
+    ReceiveAndExecute(make_128_speed_step_control_packet(
+      _addrs.primary, dcc::Forward << 7u | 42u));
+  ReceiveAndExecute(make_128_speed_step_control_packet(
+    _addrs.primary, dcc::Forward << 7u | 43u));
+  EXPECT_EQ(_mock.callbackCounts().delivered, 3uz);
+  EXPECT_EQ(_mock.callbackCounts().suppressed, 5uz);
+}
+
+TEST_F(RxTest, suppress_unchanged_functions) {
+  _mock.suppressUnchanged(true);
+  EXPECT_CALL(_mock, function(_addrs.primary.value, 0b1'1111u, 0b1'0101u));
+  EXPECT_CALL(_mock, function(_addrs.primary.value, 0b1'1111u, 0b1'0100u));
+  EXPECT_CALL(_mock, function(_addrs.primary.value, 0xFu << 5u, 0u));
+  ReceiveAndExecute(make_f0_f4_packet(_addrs.primary, 0b1'0101u));
+  ReceiveAndExecute(make_f0_f4_packet(_addrs.primary, 0b1'0101u));
+  // Other functions are unknown yet
+  ReceiveAndExecute(make_f5_f8_packet(_addrs.primary, 0u));
+  ReceiveAndExecute(make_f0_f4_packet(_addrs.primary, 0b1'0100u));
+  EXPECT_EQ(_mock.callbackCounts().delivered, 3uz);
+  EXPECT_EQ(_mock.callbackCounts().suppressed, 1uz);
+}
+
+TEST_F(RxTest, broadcast_invalidates_unchanged_speed) {
+  _mock.suppressUnchanged(true);
+  EXPECT_CALL(_mock, direction(_addrs.primary.value, dcc::Forward)).Times(2);
+  EXPECT_CALL(_mock, speed(_addrs.primary.value, dcc::scale_speed<126>(41)))
+    .Times(2);
+  EXPECT_CALL(_mock, speed(0u, dcc::EStop));
+  auto const packet{make_128_speed_step_control_packet(
+    _addrs.primary, dcc::Forward << 7u | 42u)};
+  ReceiveAndExecute(packet);
+  ReceiveAndExecute(dcc::make_speed_and_direction_packet(0u, 0b00'0001u));
+  ReceiveAndExecute(packet);
+}
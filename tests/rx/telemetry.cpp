@@ -0,0 +1,91 @@
+#include "rx_test.hpp"
+
+using namespace std::chrono_literals;
+using namespace dcc::bidi;
+
+TEST(Telemetry, higher_priority_first) {
+  dcc::rx::Telemetry<4uz> telemetry;
+  auto const temp{telemetry.add(100ms)};
+  auto const speed{telemetry.add(100ms, 1u)};
+  telemetry.set(temp, Temperature{20});
+  telemetry.set(speed, Kmh{42});
+
+  std::array<app::Dyn, 1uz> dyns;
+  dcc::rx::Clock::time_point now{};
+  EXPECT_EQ(telemetry.pull(now, dyns), 1uz);
+  EXPECT_EQ(dyns[0uz], Kmh{42});
+  EXPECT_EQ(telemetry.pull(now, dyns), 1uz);
+  EXPECT_EQ(dyns[0uz], Temperature{20});
+  EXPECT_EQ(telemetry.pull(now, dyns), 0uz);
+}
+
+TEST(Telemetry, unset_sources_and_full_registry) {
+  dcc::rx::Telemetry<1uz> telemetry;
+  auto const speed{telemetry.add(0ms)};
+  EXPECT_EQ(telemetry.add(0ms), 1uz);
+  EXPECT_EQ(telemetry.size(), 1uz);
+
+  std::array<app::Dyn, 2uz> dyns;
+  dcc::rx::Clock::time_point now{};
+  EXPECT_EQ(telemetry.pull(now, dyns), 0uz);
+  telemetry.set(speed, Kmh{42});
+  EXPECT_EQ(telemetry.pull(now, dyns), 1uz);
+}
+
+TEST(Telemetry, achieved_period) {
+  dcc::rx::Telemetry<2uz> telemetry;
+  auto const speed{telemetry.add(50ms, 1u)};
+  auto const voltage{telemetry.add(200ms)};
+  telemetry.set(speed, Kmh{42});
+  telemetry.set(voltage, TrackVoltage{16000});
+
+  // One slot every 10ms
+  std::array<app::Dyn, 1uz> dyns;
+  for (dcc::rx::Clock::time_point now{};
+       now < dcc::rx::Clock::time_point{1s};
+       now += 10ms)
+    telemetry.pull(now, dyns);
+
+  EXPECT_EQ(telemetry.stats(speed).count, 20uz);
+  EXPECT_EQ(telemetry.stats(speed).period, 50ms);
+  EXPECT_EQ(telemetry.stats(voltage).count, 5uz);
+  EXPECT_EQ(telemetry.stats(voltage).period, 200ms);
+}
+
+TEST(Telemetry, achieved_period_shrinks) {
+  dcc::rx::Telemetry<1uz> telemetry;
+  auto const speed{telemetry.add(0ms)};
+  telemetry.set(speed, Kmh{42});
+
+  // Slots every 100ms, then every 10ms
+  std::array<app::Dyn, 1uz> dyns;
+  dcc::rx::Clock::time_point now{};
+  for (auto i{0uz}; i < 3uz; ++i, now += 100ms) telemetry.pull(now, dyns);
+  EXPECT_EQ(telemetry.stats(speed).period, 100ms);
+  for (auto i{0uz}; i < 100uz; ++i, now += 10ms) {
+    telemetry.pull(now, dyns);
+    EXPECT_LE(telemetry.stats(speed).period, 100ms);
+  }
+  EXPECT_GE(telemetry.stats(speed).period, 10ms);
+  EXPECT_LE(telemetry.stats(speed).period, 20ms);
+}
+
+TEST_F(RxTest, telemetry_fills_empty_dyn_deque) {
+  auto& telemetry{_mock.telemetry()};
+  auto const speed{telemetry.add(0ms, 1u)};
+  auto const temp{telemetry.add(0ms)};
+  telemetry.set(speed, Kmh{42});
+  telemetry.set(temp, Temperature{20});
+
+  // Telemetry gets pulled in execute
+  auto packet{dcc::make_f0_f4_packet(_addrs.primary, 10u)};
+  Receive(packet)->LeaveCutout()->Execute()->Receive(packet);
+
+  std::vector<uint8_t> datagram;
+  std::ranges::copy(make_app_dyn_datagram(42u, 0u),
+                    std::back_inserter(datagram));
+  std::ranges::copy(make_app_dyn_datagram(Temperature{20}.d, 26u),
+                    std::back_inserter(datagram));
+  EXPECT_CALL(_mock, transmitBiDi(DatagramMatcher(datagram))).Times(1);
+  _mock.biDiChannel2();
+}
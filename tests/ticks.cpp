@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+#include <dcc/dcc.hpp>
+#include <ratio>
+
+namespace {
+
+using Ticks80MHz = std::ratio<1, 80'000'000>;
+using Ticks240MHz = std::ratio<1, 240'000'000>;
+using Ticks2MHz = std::ratio<1, 2'000'000>;
+using Ticks250kHz = std::ratio<4, 1'000'000>;
+
+} // namespace
+
+TEST(ticks, us2ticks) {
+  EXPECT_EQ(dcc::us2ticks(58u), 58u);
+  EXPECT_EQ(dcc::us2ticks<Ticks80MHz>(58u), 4640u);
+  EXPECT_EQ(dcc::us2ticks<Ticks240MHz>(442u), 106080u);
+  EXPECT_EQ(dcc::us2ticks<Ticks2MHz>(100u), 200u);
+
+  // Rounded to nearest
+  EXPECT_EQ(dcc::us2ticks<Ticks250kHz>(58u), 15u);
+  EXPECT_EQ(dcc::us2ticks<Ticks250kHz>(57u), 14u);
+}
+
+TEST(ticks, ticks2us) {
+  EXPECT_EQ(dcc::ticks2us(58u), 58u);
+  EXPECT_EQ(dcc::ticks2us<Ticks80MHz>(4640u), 58u);
+  EXPECT_EQ(dcc::ticks2us<Ticks250kHz>(15u), 60u);
+
+  // Rounded to nearest
+  EXPECT_EQ(dcc::ticks2us<Ticks80MHz>(4679u), 58u);
+  EXPECT_EQ(dcc::ticks2us<Ticks80MHz>(4680u), 59u);
+}
@@ -2,5 +2,7 @@
 
 TEST_F(TxTest, bytes) {
   auto packet{dcc::make_idle_packet()};
-  EXPECT_ALL_TRUE(_packet_mock.bytes(packet), _timings_mock.bytes(packet));
+  EXPECT_ALL_TRUE(_packet_mock.bytes(packet),
+                  _timings_mock.bytes(packet),
+                  _packet_ring_mock.bytes(packet));
 }
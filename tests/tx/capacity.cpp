@@ -3,4 +3,5 @@
 TEST_F(TxTest, capacity) {
   EXPECT_ALL_EQ(
     DCC_TX_DEQUE_SIZE, _packet_mock.capacity(), _timings_mock.capacity());
+  EXPECT_EQ(DCC_TX_PACKET_RING_SIZE, _packet_ring_mock.capacity());
 }
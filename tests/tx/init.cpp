@@ -5,4 +5,5 @@ TEST_F(TxTest, init) {
     .num_preamble = 1u, .bit1_duration = 51u, .bit0_duration = 113u};
   ASSERT_DEBUG_DEATH(_packet_mock.init(cfg), ".*");
   ASSERT_DEBUG_DEATH(_timings_mock.init(cfg), ".*");
+  ASSERT_DEBUG_DEATH(_packet_ring_mock.init(cfg), ".*");
 }
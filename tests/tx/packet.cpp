@@ -2,5 +2,7 @@
 
 TEST_F(TxTest, packet) {
   auto packet{dcc::make_idle_packet()};
-  EXPECT_ALL_TRUE(_packet_mock.packet(packet), _timings_mock.packet(packet));
+  EXPECT_ALL_TRUE(_packet_mock.packet(packet),
+                  _timings_mock.packet(packet),
+                  _packet_ring_mock.packet(packet));
 }
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <dcc/dcc.hpp>
+
+TEST(PacketRing, capacity_is_measured_in_bytes) {
+  dcc::tx::BasicPacketRing<128uz> ring;
+  auto packet{dcc::make_idle_packet()};
+
+  // Each packet takes its size plus one header byte
+  auto const count{128uz / (size(packet) + 1uz)};
+  for (auto i{0uz}; i < count; ++i)
+    EXPECT_TRUE(ring.push_back({cbegin(packet), size(packet)}, {}));
+  EXPECT_FALSE(ring.push_back({cbegin(packet), size(packet)}, {}));
+  EXPECT_EQ(size(ring), count);
+  EXPECT_EQ(ring.bytes(), count * (size(packet) + 1uz));
+}
+
+TEST(PacketRing, packets_wrap_around) {
+  dcc::tx::BasicPacketRing<32uz> ring;
+
+  // Mix basic and extended addresses to get different packet sizes
+  for (auto i{0u}; i < 100u; ++i) {
+    auto packet{dcc::make_128_speed_step_control_packet(
+      i % 3u ? dcc::Address{.value = 3u, .type = dcc::Address::BasicLoco}
+             : dcc::Address{.value = 1000u, .type = dcc::Address::ExtendedLoco},
+      static_cast<uint8_t>(i))};
+    ASSERT_TRUE(ring.push_back({cbegin(packet), size(packet)}, {}));
+    EXPECT_EQ(ring.front().first, packet);
+    ring.pop_front();
+  }
+  EXPECT_TRUE(empty(ring));
+}
+
+TEST(PacketRing, configurations_are_kept_per_packet) {
+  dcc::tx::BasicPacketRing<128uz> ring;
+  auto packet{dcc::make_idle_packet()};
+
+  // Fill configuration table
+  for (auto i{0u}; i < 8u; ++i)
+    EXPECT_TRUE(ring.push_back(
+      {cbegin(packet), size(packet)},
+      {.num_preamble = static_cast<uint8_t>(DCC_TX_MIN_PREAMBLE_BITS + i)}));
+
+  // Table is exhausted
+  EXPECT_FALSE(
+    ring.push_back({cbegin(packet), size(packet)}, {.num_preamble = 30u}));
+
+  // Equal configuration is reused
+  EXPECT_TRUE(ring.push_back({cbegin(packet), size(packet)},
+                             {.num_preamble = DCC_TX_MIN_PREAMBLE_BITS}));
+
+  for (auto i{0u}; i < 8u; ++i) {
+    EXPECT_EQ(ring.front().second.num_preamble, DCC_TX_MIN_PREAMBLE_BITS + i);
+    ring.pop_front();
+  }
+  EXPECT_EQ(ring.front().second.num_preamble, DCC_TX_MIN_PREAMBLE_BITS);
+  ring.pop_front();
+  EXPECT_TRUE(empty(ring));
+}
@@ -22,3 +22,13 @@ TEST(TimingsAdapter, compare_to_packet2timings) {
     EXPECT_TRUE(std::ranges::equal(timings, timings_range));
   }
 }
+
+TEST(TimingsAdapter, compare_to_packet2timings_in_ticks) {
+  using Period = std::ratio<1, 240'000'000>;
+  auto packet{
+    dcc::make_speed_direction_and_functions_packet(42u, 100u, 10u, 19u)};
+  auto timings{dcc::tx::packet2timings<Period>(packet)};
+  dcc::tx::TimingsAdapter timings_range{packet, dcc::tx::Config{}, Period{}};
+  EXPECT_TRUE(std::ranges::equal(timings, timings_range));
+  EXPECT_EQ(*begin(timings_range), dcc::tx::Bit1 * 240u);
+}
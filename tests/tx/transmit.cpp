@@ -14,7 +14,8 @@ TEST_F(TxTest, consecutive_idle_packets) {
   for (auto i{0uz}; i < bits; ++i)
     EXPECT_ALL_EQ(timings[static_cast<dcc::tx::Timings::size_type>(i)],
                   _packet_mock.transmit(),
-                  _timings_mock.transmit());
+                  _timings_mock.transmit(),
+                  _packet_ring_mock.transmit());
 }
 
 TEST_F(TxTest, consecutive_packets_without_cutout) {
@@ -30,17 +31,21 @@ TEST_F(TxTest, consecutive_packets_without_cutout) {
   for (auto i{0uz}; i < bits; ++i)
     EXPECT_ALL_EQ(timings[static_cast<dcc::tx::Timings::size_type>(i)],
                   _packet_mock.transmit(),
-                  _timings_mock.transmit());
+                  _timings_mock.transmit(),
+                  _packet_ring_mock.transmit());
   for (auto i{0uz}; i < bits; ++i)
     EXPECT_ALL_EQ(timings[static_cast<dcc::tx::Timings::size_type>(i)],
                   _packet_mock.transmit(),
-                  _timings_mock.transmit());
+                  _timings_mock.transmit(),
+                  _packet_ring_mock.transmit());
 }
 
 TEST_F(TxTest, consecutive_packets_with_cutout) {
   {
     auto packet{dcc::make_f9_f12_packet(3u, 0b0000'1100u)};
-    EXPECT_ALL_TRUE(_packet_mock.packet(packet), _timings_mock.packet(packet));
+    EXPECT_ALL_TRUE(_packet_mock.packet(packet),
+                    _timings_mock.packet(packet),
+                    _packet_ring_mock.packet(packet));
     auto timings{dcc::tx::packet2timings(packet, _cfg)};
     auto bits{(_cfg.num_preamble +                  // Preamble
                std::size(packet) * (1uz + CHAR_BIT) // Start + data
@@ -49,30 +54,36 @@ TEST_F(TxTest, consecutive_packets_with_cutout) {
     for (auto i{0uz}; i < bits; ++i)
       EXPECT_ALL_EQ(timings[static_cast<dcc::tx::Timings::size_type>(i)],
                     _packet_mock.transmit(),
-                    _timings_mock.transmit());
+                    _timings_mock.transmit(),
+                    _packet_ring_mock.transmit());
   }
 
   {
     EXPECT_ALL_EQ(
       static_cast<dcc::tx::Timings::value_type>(dcc::bidi::Timing::TCS),
       _packet_mock.transmit(),
-      _timings_mock.transmit());
+      _timings_mock.transmit(),
+      _packet_ring_mock.transmit());
     EXPECT_ALL_EQ(static_cast<dcc::tx::Timings::value_type>(
                     dcc::bidi::Timing::TTS1 - dcc::bidi::Timing::TCS),
                   _packet_mock.transmit(),
-                  _timings_mock.transmit());
+                  _timings_mock.transmit(),
+                  _packet_ring_mock.transmit());
     EXPECT_ALL_EQ(static_cast<dcc::tx::Timings::value_type>(
                     dcc::bidi::Timing::TTS2 - dcc::bidi::Timing::TTS1),
                   _packet_mock.transmit(),
-                  _timings_mock.transmit());
+                  _timings_mock.transmit(),
+                  _packet_ring_mock.transmit());
     EXPECT_ALL_EQ(static_cast<dcc::tx::Timings::value_type>(
                     dcc::bidi::Timing::TTC2 - dcc::bidi::Timing::TTS2),
                   _packet_mock.transmit(),
-                  _timings_mock.transmit());
+                  _timings_mock.transmit(),
+                  _packet_ring_mock.transmit());
     EXPECT_ALL_EQ(static_cast<dcc::tx::Timings::value_type>(
                     dcc::bidi::Timing::TCE - dcc::bidi::Timing::TTC2),
                   _packet_mock.transmit(),
-                  _timings_mock.transmit());
+                  _timings_mock.transmit(),
+                  _packet_ring_mock.transmit());
   }
 
   {
@@ -85,6 +96,31 @@ TEST_F(TxTest, consecutive_packets_with_cutout) {
     for (auto i{0uz}; i < bits; ++i)
       EXPECT_ALL_EQ(timings[static_cast<dcc::tx::Timings::size_type>(i)],
                     _packet_mock.transmit(),
-                    _timings_mock.transmit());
+                    _timings_mock.transmit(),
+                    _packet_ring_mock.transmit());
   }
 }
+
+namespace {
+
+template<typename T>
+void TransmitInTicks() {
+  using Period = std::ratio<1, 80'000'000>;
+  NiceMock<TxMock<T>> us_mock;
+  NiceMock<TxMock<T, Period>> ticks_mock;
+  us_mock.init({.flags = {.bidi = true}});
+  ticks_mock.init({.flags = {.bidi = true}});
+  auto const packet{dcc::make_f9_f12_packet(3u, 0b0000'1100u)};
+  us_mock.packet(packet);
+  ticks_mock.packet(packet);
+  for (auto i{0uz}; i < 500uz; ++i)
+    EXPECT_EQ(us_mock.transmit() * 80u, ticks_mock.transmit());
+}
+
+} // namespace
+
+TEST(TxTicks, transmit_in_ticks) {
+  TransmitInTicks<dcc::Packet>();
+  TransmitInTicks<dcc::tx::Timings>();
+  TransmitInTicks<dcc::tx::PacketRing>();
+}
@@ -0,0 +1,105 @@
+#include "tx_test.hpp"
+
+namespace {
+
+template<typename T>
+void FullBitStreamExpandsToHalfBitStream(dcc::tx::Config cfg) {
+  NiceMock<TxMock<T>> half_mock, full_mock;
+  half_mock.init(cfg);
+  full_mock.init(cfg);
+
+  for (auto const& packet :
+       {dcc::make_f9_f12_packet(3u, 0b0000'1100u),
+        dcc::make_128_speed_step_control_packet(
+          {.value = 1000u, .type = dcc::Address::ExtendedLoco}, 42u),
+        dcc::make_reset_packet()}) {
+    half_mock.packet(packet);
+    full_mock.packet(packet);
+  }
+
+  // Full-bit mode never toggles track outputs
+  EXPECT_CALL(full_mock, trackOutputs(_, _)).Times(0);
+
+  // Edges of full-bit stream are at start and in the middle of each symbol
+  std::vector<uint32_t> full_edges;
+  uint32_t full_time{};
+  for (auto i{0uz}; i < 1000uz; ++i) {
+    auto const symbol{full_mock.transmitSymbol()};
+    EXPECT_TRUE(symbol.cutout || symbol.first == symbol.second);
+    full_edges.push_back(full_time);
+    full_edges.push_back(full_time + symbol.first);
+    full_time += symbol.first + symbol.second;
+  }
+
+  // Edges of half-bit stream are whenever track outputs get toggled
+  std::vector<uint32_t> half_edges;
+  uint32_t half_time{};
+  ON_CALL(half_mock, trackOutputs(_, _)).WillByDefault([&] {
+    half_edges.push_back(half_time);
+  });
+  while (half_time < full_time) half_time += half_mock.transmit();
+
+  EXPECT_EQ(half_time, full_time);
+  EXPECT_EQ(half_edges, full_edges);
+}
+
+} // namespace
+
+TEST(TxSymbol, full_bit_stream_expands_to_half_bit_stream) {
+  FullBitStreamExpandsToHalfBitStream<dcc::Packet>({});
+  FullBitStreamExpandsToHalfBitStream<dcc::tx::Timings>({});
+  FullBitStreamExpandsToHalfBitStream<dcc::tx::PacketRing>({});
+}
+
+TEST(TxSymbol, full_bit_stream_expands_to_half_bit_stream_without_cutout) {
+  FullBitStreamExpandsToHalfBitStream<dcc::Packet>({.flags = {.bidi = false}});
+  FullBitStreamExpandsToHalfBitStream<dcc::tx::Timings>(
+    {.flags = {.bidi = false}});
+  FullBitStreamExpandsToHalfBitStream<dcc::tx::PacketRing>(
+    {.flags = {.bidi = false}});
+}
+
+TEST(TxSymbol, cutout_symbol) {
+  NiceMock<TxMock<dcc::Packet>> mock;
+  mock.init();
+
+  // Skip idle packet
+  auto const bits{(DCC_TX_MIN_PREAMBLE_BITS +          // Preamble
+                   size(dcc::make_idle_packet()) * 9uz // Start + data
+                   + 1uz)};                            // End
+  for (auto i{0uz}; i < bits; ++i) mock.transmitSymbol();
+
+  InSequence s;
+  EXPECT_CALL(mock, packetEnd());
+  EXPECT_CALL(mock, biDiStart());
+  EXPECT_EQ(mock.transmitSymbol(),
+            (dcc::tx::Symbol{.first = dcc::bidi::Timing::TCS,
+                             .second = dcc::bidi::Timing::TCE -
+                                       dcc::bidi::Timing::TCS,
+                             .cutout = true}));
+  EXPECT_CALL(mock, biDiEnd());
+  EXPECT_EQ(mock.transmitSymbol(),
+            (dcc::tx::Symbol{.first = dcc::tx::Bit1, .second = dcc::tx::Bit1}));
+}
+
+TEST(TxSymbol, cutout_symbol_in_ticks) {
+  NiceMock<TxMock<dcc::Packet, std::ratio<1, 240'000'000>>> mock;
+  mock.init();
+
+  // Skip idle packet
+  auto const bits{(DCC_TX_MIN_PREAMBLE_BITS +          // Preamble
+                   size(dcc::make_idle_packet()) * 9uz // Start + data
+                   + 1uz)};                            // End
+  for (auto i{0uz}; i < bits; ++i) mock.transmitSymbol();
+
+  // Cutout exceeds uint16_t at 240MHz
+  EXPECT_EQ(mock.transmitSymbol(),
+            (dcc::tx::Symbol{.first = dcc::bidi::Timing::TCS * 240u,
+                             .second = (dcc::bidi::Timing::TCE -
+                                        dcc::bidi::Timing::TCS) *
+                                       240u,
+                             .cutout = true}));
+  EXPECT_EQ(mock.transmitSymbol(),
+            (dcc::tx::Symbol{.first = dcc::tx::Bit1 * 240u,
+                             .second = dcc::tx::Bit1 * 240u}));
+}
@@ -4,8 +4,8 @@
 #include <gtest/gtest.h>
 #include <dcc/dcc.hpp>
 
-template<typename T>
-struct TxMock : dcc::tx::CrtpBase<TxMock<T>, T> {
+template<typename T, typename Period = std::micro>
+struct TxMock : dcc::tx::CrtpBase<TxMock<T, Period>, T, Period> {
   MOCK_METHOD(void, trackOutputs, (bool, bool), ());
   MOCK_METHOD(void, packetEnd, (), ());
   MOCK_METHOD(void, biDiStart, (), ());
@@ -18,4 +18,5 @@ struct TxTest : ::testing::Test {
                        .bit0_duration = 113u};
   NiceMock<TxMock<dcc::Packet>> _packet_mock;
   NiceMock<TxMock<dcc::tx::Timings>> _timings_mock;
+  NiceMock<TxMock<dcc::tx::PacketRing>> _packet_ring_mock;
 };